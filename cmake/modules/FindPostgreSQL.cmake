@@ -185,6 +185,10 @@ if(POSTGRESQL_FOUND)
   else()
     set(POSTGRESQL_LIBRARIES ${POSTGRESQL_LIBRARY})
   endif()
+  if(WIN32)
+    # Needed for WSAPoll() used when waiting for notifications.
+    list(APPEND POSTGRESQL_LIBRARIES ws2_32)
+  endif()
   set(POSTGRESQL_VERSION ${POSTGRESQL_VERSION_STRING})
 endif()
 
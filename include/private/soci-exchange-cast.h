@@ -14,6 +14,7 @@
 
 #include <cstdint>
 #include <ctime>
+#include <vector>
 
 namespace soci
 {
@@ -114,6 +115,12 @@ struct exchange_type_traits<x_blob>
   typedef blob value_type;
 };
 
+template <>
+struct exchange_type_traits<x_binary>
+{
+  typedef std::vector<uint8_t> value_type;
+};
+
 // exchange_type_traits not defined for x_statement, x_rowid and x_blob here.
 
 template <exchange_type e>
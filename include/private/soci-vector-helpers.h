@@ -57,6 +57,8 @@ inline std::size_t get_vector_size(exchange_type e, void *data)
             return exchange_vector_type_cast<x_xmltype>(data).size();
         case x_longstring:
             return exchange_vector_type_cast<x_longstring>(data).size();
+        case x_binary:
+            return exchange_vector_type_cast<x_binary>(data).size();
         case x_statement:
         case x_rowid:
         case x_blob:
@@ -112,6 +114,9 @@ inline void resize_vector(exchange_type e, void *data, std::size_t newSize)
         case x_longstring:
             exchange_vector_type_cast<x_longstring>(data).resize(newSize);
             return;
+        case x_binary:
+            exchange_vector_type_cast<x_binary>(data).resize(newSize);
+            return;
         case x_statement:
         case x_rowid:
         case x_blob:
@@ -145,6 +150,7 @@ inline std::string& vector_string_value(exchange_type e, void *data, std::size_t
         case x_statement:
         case x_rowid:
         case x_blob:
+        case x_binary:
             break;
     }
     throw soci_error("Can't get the string value from the vector of values with non-supported type.");
@@ -53,6 +53,7 @@ namespace soci
     }}
 
     static const std::size_t maxBuffer =  1024 * 1024 * 1024; //CLI limit is about 3 GB, but 1GB should be enough
+    static const std::size_t maxColSize = 8000; //bigger columns are not bound but retrieved with SQLGetData() in chunks
 
 class SOCI_DB2_DECL db2_soci_error : public soci_error {
 public:
@@ -99,7 +100,7 @@ struct SOCI_DB2_DECL db2_standard_into_type_backend : details::standard_into_typ
 struct SOCI_DB2_DECL db2_vector_into_type_backend : details::vector_into_type_backend
 {
     db2_vector_into_type_backend(db2_statement_backend &st)
-        : statement_(st),buf(NULL)
+        : statement_(st),buf(NULL),longColumn(false)
     {}
 
     void define_by_pos(int& position, void* data, details::exchange_type type) override;
@@ -115,6 +116,7 @@ struct SOCI_DB2_DECL db2_vector_into_type_backend : details::vector_into_type_ba
     db2_statement_backend& statement_;
 
     void prepare_indicators(std::size_t size);
+    void get_long_data();
 
     std::vector<SQLLEN> indVec;
     void *data;
@@ -123,6 +125,7 @@ struct SOCI_DB2_DECL db2_vector_into_type_backend : details::vector_into_type_ba
     details::exchange_type type;
     SQLSMALLINT cType;
     std::size_t colSize;
+    bool longColumn;
 };
 
 struct SOCI_DB2_DECL db2_standard_use_type_backend : details::standard_use_type_backend
@@ -179,7 +182,8 @@ struct SOCI_DB2_DECL db2_vector_use_type_backend : details::vector_use_type_back
 };
 
 struct db2_session_backend;
-struct SOCI_DB2_DECL db2_statement_backend : details::statement_backend
+struct SOCI_DB2_DECL db2_statement_backend : details::statement_backend,
+                                             details::struct_binding_backend
 {
     db2_statement_backend(db2_session_backend &session);
 
@@ -205,6 +209,10 @@ struct SOCI_DB2_DECL db2_statement_backend : details::statement_backend
     db2_vector_into_type_backend* make_vector_into_type_backend() override;
     db2_vector_use_type_backend* make_vector_use_type_backend() override;
 
+    void define_struct_by_pos(int& position, details::struct_vector_base& v) override;
+    void bind_struct_by_pos(int& position, details::struct_vector_base& v) override;
+    void clean_up_struct(details::struct_vector_base& v) override;
+
     db2_session_backend& session_;
 
     SQLHANDLE hStmt;
@@ -213,6 +221,18 @@ struct SOCI_DB2_DECL db2_statement_backend : details::statement_backend
     bool hasVectorUseElements;
     SQLUINTEGER numRowsFetched;
     details::db2::binding_method use_binding_method_;
+
+    // Vectors of structs using row-wise binding for the columns and the
+    // parameters starting at the given positions, if any.
+    details::struct_vector_base* structInto;
+    details::struct_vector_base* structUse;
+    int structIntoPosition;
+    int structUsePosition;
+
+private:
+    // Helpers binding all the fields of structInto or structUse, row-wise.
+    void bind_struct_columns(int rows);
+    void bind_struct_parameters();
 };
 
 struct SOCI_DB2_DECL db2_rowid_backend : details::rowid_backend
@@ -169,6 +169,17 @@ struct exchange_traits<std::vector<T> >
     enum { x_type = exchange_traits<T>::x_type };
 };
 
+// std::vector<uint8_t> can only be used as the element type of the vectors
+// used in bulk operations, e.g. std::vector<std::vector<uint8_t>>, in which
+// case it represents a single binary value. When used directly, it is still
+// just a vector of uint8_t values.
+template <>
+struct exchange_traits<std::vector<uint8_t> >
+{
+    typedef basic_type_tag type_family;
+    enum { x_type = x_binary };
+};
+
 // handling of wrapper types
 
 template <>
@@ -83,7 +83,8 @@ struct firebird_standard_into_type_backend : details::standard_into_type_backend
 struct firebird_vector_into_type_backend : details::vector_into_type_backend
 {
     firebird_vector_into_type_backend(firebird_statement_backend &st)
-        : statement_(st), data_(NULL), type_(), position_(0), buf_(NULL), indISCHolder_(0)
+        : statement_(st), data_(NULL), type_(), position_(0), buf_(NULL), indISCHolder_(0),
+          converter_(NULL)
     {}
 
     void define_by_pos(int &position,
@@ -106,6 +107,16 @@ struct firebird_vector_into_type_backend : details::vector_into_type_backend
 
     char *buf_;
     short indISCHolder_;
+
+    // Function storing the value fetched into buf_ in the given row of the
+    // vector, selected in define_by_pos() depending on the exchange and the
+    // column types to avoid checking them for every row.
+    typedef void (*converter_type)(firebird_vector_into_type_backend &into,
+        std::size_t row);
+    converter_type converter_;
+
+    static converter_type selectConverter(details::exchange_type type,
+        XSQLVAR const *var);
 };
 
 struct firebird_standard_use_type_backend : details::standard_use_type_backend
@@ -174,11 +185,11 @@ struct firebird_vector_use_type_backend : details::vector_use_type_backend
     short indISCHolder_;
 
 private:
-    // Allocate a temporary blob, fill it with the data from the provided
-    // string and copy its ID into buf_.
-    void copy_to_blob(const std::string &in);
+    // Allocate a temporary blob, fill it with the provided data and copy its
+    // ID into buf_.
+    void copy_to_blob(char const *data, std::size_t len);
 
-    // This is used for types mapping to CLOB.
+    // This is used for types mapping to CLOB or BLOB.
     firebird_blob_backend *blob_;
 };
 
@@ -238,6 +249,11 @@ protected:
     virtual void rewriteParameters(std::string const & src,
         std::vector<char> & dst);
 
+    // Execute the statement for all the given rows of vector use elements
+    // using a single batch, if possible. Returns false if batches are not
+    // supported, in which case nothing was done.
+    bool executeBatch(std::size_t rows);
+
     BuffersType intoType_;
     BuffersType useType_;
 
@@ -249,6 +265,9 @@ protected:
     std::map <std::string, int> names_;
 
     bool procedure_;
+
+    // false if batch execution can't be used with this statement
+    bool useBatch_;
 };
 
 struct SOCI_FIREBIRD_DECL firebird_blob_backend : details::blob_backend
@@ -18,6 +18,7 @@
 #endif
 
 #include <soci/soci-backend.h>
+#include <soci/exchange-traits.h>
 #include <soci/trivial-blob-backend.h>
 #ifdef _WIN32
 #include <winsock.h> // SOCKET
@@ -42,12 +43,28 @@
     SOCI_GCC_WARNING_RESTORE(pedantic)
 #endif
 
+#include <map>
+#include <type_traits>
 #include <vector>
 
 
 namespace soci
 {
 
+namespace details
+{
+
+namespace mysql
+{
+
+// Type of the boolean fields of MYSQL_BIND: this is my_bool in MariaDB and
+// older MySQL versions but plain bool since MySQL 8.
+typedef std::remove_pointer<decltype(MYSQL_BIND::is_null)>::type bind_bool;
+
+} // namespace mysql
+
+} // namespace details
+
 class SOCI_MYSQL_DECL mysql_soci_error : public soci_error
 {
 public:
@@ -68,6 +85,33 @@ public:
     error_category cat_;
 };
 
+// Value exchanged with the server using the binary protocol, this is used for
+// both the parameters and the results of the prepared statements.
+struct mysql_bind_value
+{
+    mysql_bind_value()
+        : type_(MYSQL_TYPE_NULL), unsigned_(false), integer_(0), double_(0),
+          time_(), length_(0), isNull_(0), error_(0) {}
+
+    // Fill the given structure to refer to this value.
+    void bind(MYSQL_BIND &b);
+
+    // Only the LONGLONG, DOUBLE, DATETIME, STRING and BLOB buffer types are
+    // used, NULL is used for the null parameters.
+    enum_field_types type_;
+    bool unsigned_;
+
+    // Only one of these fields is used, depending on the type.
+    long long integer_;
+    double double_;
+    MYSQL_TIME time_;
+    std::vector<char> buffer_;
+
+    unsigned long length_;
+    details::mysql::bind_bool isNull_;
+    details::mysql::bind_bool error_;
+};
+
 struct mysql_statement_backend;
 struct mysql_standard_into_type_backend : details::standard_into_type_backend
 {
@@ -135,6 +179,9 @@ struct mysql_standard_use_type_backend : details::standard_use_type_backend
     int position_;
     std::string name_;
     char *buf_;
+
+    // Used instead of buf_ for the prepared statements.
+    mysql_bind_value value_;
 };
 
 struct mysql_vector_use_type_backend : details::vector_use_type_backend
@@ -160,12 +207,16 @@ struct mysql_vector_use_type_backend : details::vector_use_type_backend
     int position_;
     std::string name_;
     std::vector<char *> buffers_;
+
+    // Used instead of buffers_ for the prepared statements.
+    std::vector<mysql_bind_value> values_;
 };
 
 struct mysql_session_backend;
 struct SOCI_MYSQL_DECL mysql_statement_backend : details::statement_backend
 {
     mysql_statement_backend(mysql_session_backend &session);
+    ~mysql_statement_backend() override;
 
     void alloc() override;
     void clean_up() override;
@@ -192,10 +243,60 @@ struct SOCI_MYSQL_DECL mysql_statement_backend : details::statement_backend
     mysql_vector_into_type_backend * make_vector_into_type_backend() override;
     mysql_vector_use_type_backend * make_vector_use_type_backend() override;
 
+    // Enable or disable using server-side prepared statements for this
+    // statement, see the "prepared" connection option in the documentation.
+    // This must be called before executing the statement for the first time.
+    void set_use_prepared(bool usePrepared) { usePrepared_ = usePrepared; }
+
+    // Enable or disable streaming the rows of the query results instead of
+    // retrieving all of them at once, see the "streaming" connection option
+    // in the documentation. This must be called before executing the
+    // statement.
+    void set_use_streaming(bool useStreaming) { useStreaming_ = useStreaming; }
+
+    // Enable or disable rewriting bulk INSERT statements to use multi-row
+    // VALUES syntax, which is done by default.
+    void set_rewrite_bulk_insert(bool rewrite) { rewriteBulkInsert_ = rewrite; }
+
+    // Functions used only when using prepared statements.
+    exec_fetch_result execute_prepared(int number);
+    void bind_prepared_results();
+    void fetch_prepared_row(int row);
+
+    // Return the given row of the result, which must be one of the rows
+    // consumed by the current fetch, and the lengths of its columns.
+    MYSQL_ROW get_row(int row, unsigned long *&lengths);
+
+    // Read the next batch of rows in streaming mode.
+    exec_fetch_result fetch_streaming(int number);
+
+    // Fill the vector with the formatted values of the parameters for the
+    // given row.
+    void get_param_values(int row, std::vector<char *> &paramValues);
+
+    // Execute a bulk INSERT using multi-row VALUES syntax, return false if
+    // the query can't be rewritten in this way.
+    bool execute_multi_row_insert(int numberOfRows);
+
     mysql_session_backend &session_;
 
     MYSQL_RES *result_;
 
+    // If true, the statement is executed using the server-side prepared
+    // statements API instead of sending the query text with the parameter
+    // values spliced in it. This is initialized from the session option but
+    // can be changed using set_use_prepared().
+    bool usePrepared_;
+
+    MYSQL_STMT *stmt_;
+    bool stmtPrepared_; // true if stmt_ was prepared for the current query
+
+    // Buffers for the result columns of the prepared statement, the row
+    // currently fetched into them is preparedRow_ (or -1).
+    std::vector<mysql_bind_value> resultValues_;
+    std::vector<MYSQL_BIND> resultBinds_;
+    int preparedRow_;
+
     // The query is split into chunks, separated by the named parameters;
     // e.g. for "SELECT id FROM ttt WHERE name = :foo AND gender = :bar"
     // we will have query chunks "SELECT id FROM ttt WHERE name = ",
@@ -220,6 +321,26 @@ struct SOCI_MYSQL_DECL mysql_statement_backend : details::statement_backend
     // random access to rows, since mysql_data_seek() is expensive.
     std::vector<MYSQL_ROW_OFFSET> resultRowOffsets_;
 
+    // If true, mysql_use_result() is used instead of mysql_store_result() and
+    // only the rows of the current batch are kept in memory. This is
+    // initialized from the session option but can be changed using
+    // set_use_streaming(). It is not used for the prepared statements.
+    bool useStreaming_;
+
+    // The rows of the current batch in streaming mode: they are copied as
+    // the data returned by mysql_fetch_row() is only valid until the next
+    // call to it. The cells and their lengths are stored row by row.
+    std::vector<char> streamData_;
+    std::vector<std::size_t> streamOffsets_;
+    std::vector<char *> streamCells_;
+    std::vector<unsigned long> streamLengths_;
+
+    // If true (default), bulk INSERT statements with a single VALUES tuple
+    // are executed by sending as few multi-row INSERTs as possible instead
+    // of executing the statement once for each row, see
+    // set_rewrite_bulk_insert().
+    bool rewriteBulkInsert_;
+
     bool hasIntoElements_;
     bool hasVectorIntoElements_;
     bool hasUseElements_;
@@ -233,6 +354,13 @@ struct SOCI_MYSQL_DECL mysql_statement_backend : details::statement_backend
 
     typedef std::map<std::string, char **> UseByNameBuffersMap;
     UseByNameBuffersMap useByNameBuffers_;
+
+    // Same as above but for the prepared statements.
+    typedef std::map<int, mysql_bind_value *> UseByPosValuesMap;
+    UseByPosValuesMap useByPosValues_;
+
+    typedef std::map<std::string, mysql_bind_value *> UseByNameValuesMap;
+    UseByNameValuesMap useByNameValues_;
 };
 
 struct SOCI_MYSQL_DECL mysql_rowid_backend : details::rowid_backend
@@ -256,6 +384,81 @@ public:
     void load_from_hex_str(const char* str, std::size_t length);
 };
 
+// Describes the data to be loaded by mysql_session_backend::load_data().
+//
+// The data is specified as a number of columns, each of which corresponds to
+// a vector of values (and, optionally, indicators), e.g.
+//
+//      mysql_data_loader loader("person");
+//      loader.column("id", ids).column("name", names, nameIndicators);
+//
+// All vectors must have the same size and must remain alive until the data is
+// loaded.
+struct SOCI_MYSQL_DECL mysql_data_loader
+{
+    explicit mysql_data_loader(std::string const &table) : table_(table) {}
+
+    template <typename T>
+    mysql_data_loader &column(std::string const &name,
+        std::vector<T> const &values)
+    {
+        return add_column<T>(name, values, NULL);
+    }
+
+    template <typename T>
+    mysql_data_loader &column(std::string const &name,
+        std::vector<T> const &values, std::vector<indicator> const &ind)
+    {
+        return add_column<T>(name, values, &ind);
+    }
+
+    struct column_data
+    {
+        std::string name_;
+        details::exchange_type type_;
+        void const *data_; // pointer to std::vector<T>
+        std::size_t (*get_size_)(void const *data);
+        std::vector<indicator> const *ind_;
+    };
+
+    std::string table_;
+    std::vector<column_data> columns_;
+
+private:
+    template <typename T>
+    static std::size_t get_vector_size(void const *data)
+    {
+        return static_cast<std::vector<T> const *>(data)->size();
+    }
+
+    template <typename T>
+    mysql_data_loader &add_column(std::string const &name,
+        std::vector<T> const &values, std::vector<indicator> const *ind)
+    {
+        static_assert(std::is_same<
+                typename details::exchange_traits<T>::type_family,
+                details::basic_type_tag
+            >::value, "Only the basic types can be loaded");
+
+        column_data c;
+        c.name_ = name;
+        c.type_ = static_cast<details::exchange_type>(
+            details::exchange_traits<T>::x_type);
+        c.data_ = &values;
+        c.get_size_ = &get_vector_size<T>;
+        c.ind_ = ind;
+        columns_.push_back(c);
+        return *this;
+    }
+};
+
+// Result of mysql_session_backend::load_data().
+struct mysql_load_data_result
+{
+    unsigned long long rows_;   // number of rows loaded
+    unsigned int warnings_;     // number of warnings generated by the server
+};
+
 struct SOCI_MYSQL_DECL mysql_session_backend : details::session_backend
 {
     mysql_session_backend(connection_parameters const & parameters);
@@ -305,6 +508,25 @@ struct SOCI_MYSQL_DECL mysql_session_backend : details::session_backend
     }
 
     MYSQL *conn_;
+
+    // Use server-side prepared statements by default, see the "prepared"
+    // connection option.
+    bool usePreparedStatements_;
+
+    // Retrieve the results incrementally by default, see the "streaming"
+    // connection option.
+    bool useStreaming_;
+
+    // Load the data into the table using LOAD DATA LOCAL INFILE statement,
+    // streaming it directly from memory without using any files. Notice that
+    // this requires "local_infile=1" connection option and the server must
+    // allow loading local data too.
+    mysql_load_data_result load_data(mysql_data_loader const &loader);
+
+    // Return the value of the max_allowed_packet server variable, which is
+    // retrieved only once and cached.
+    std::size_t get_max_allowed_packet();
+    std::size_t maxAllowedPacket_;
 };
 
 
@@ -18,7 +18,10 @@
 
 #include <vector>
 #include <soci/soci-backend.h>
+#include <list>
+#include <map>
 #include <sstream>
+#include <string>
 #if defined(_MSC_VER) || defined(__MINGW32__)
 #include <windows.h>
 #endif
@@ -30,13 +33,21 @@ namespace soci
 
 namespace details
 {
-    // TODO: Do we want to make it a part of public interface? --mloskot
-    std::size_t const odbc_max_buffer_length = 100 * 1024 * 1024;
-
     // select max size from following MSDN article
     // https://msdn.microsoft.com/en-us/library/ms130896.aspx
+    //
+    // Columns of this or bigger size (or of unknown size) are not bound but
+    // are retrieved using SQLGetData() after fetching each row instead.
     SQLLEN const ODBC_MAX_COL_SIZE = 8000;
 
+    // Size of the initial buffer used for retrieving the values of such
+    // columns, it is increased as necessary if the value doesn't fit into it.
+    std::size_t const odbc_long_data_chunk_size = 4096;
+
+    // The maximal number of unused statement handles kept by the session for
+    // reuse instead of being freed.
+    std::size_t const odbc_max_free_statements = 16;
+
     // This cast is only used to avoid compiler warnings when passing strings
     // to ODBC functions, the returned string may *not* be really modified.
     inline SQLCHAR* sqlchar_cast(std::string const& s)
@@ -51,6 +62,11 @@ namespace details
 // string form as all options are strings currently).
 extern SOCI_ODBC_DECL char const * odbc_option_driver_complete;
 
+// Option specifying the maximal number of prepared statements kept by the
+// session for reuse when the same query is executed again, 0 (default) means
+// that the statements are always prepared anew.
+extern SOCI_ODBC_DECL char const * odbc_option_statement_cache;
+
 struct odbc_statement_backend;
 
 // Helper of into and use backends.
@@ -81,8 +97,17 @@ protected:
     inline bool supports_negative_tinyint() const;
     inline bool can_convert_to_unsigned_sql_type() const;
 
+    // Retrieve the value of the given column of the current row using as many
+    // SQLGetData() calls as necessary and return its length or SQL_NULL_DATA.
+    SQLLEN get_long_data(SQLUSMALLINT colNum, std::string &value);
+    SQLLEN get_long_data(SQLUSMALLINT colNum, std::vector<uint8_t> &value);
+
     odbc_statement_backend &statement_;
 private:
+    // Common implementation of both get_long_data() overloads.
+    template <typename T>
+    SQLLEN do_get_long_data(SQLUSMALLINT colNum, SQLSMALLINT cType, T &value);
+
     SOCI_NOT_COPYABLE(odbc_standard_type_backend_base)
 };
 
@@ -90,7 +115,7 @@ struct odbc_standard_into_type_backend : details::standard_into_type_backend,
                                          private odbc_standard_type_backend_base
 {
     odbc_standard_into_type_backend(odbc_statement_backend &st)
-        : odbc_standard_type_backend_base(st), buf_(0)
+        : odbc_standard_type_backend_base(st), buf_(0), lateBound_(false)
     {}
 
     void define_by_pos(int &position,
@@ -102,12 +127,21 @@ struct odbc_standard_into_type_backend : details::standard_into_type_backend,
 
     void clean_up() override;
 
+    // Retrieve the value of the late bound column for the current row.
+    void get_late_bound_value();
+
     char *buf_;        // generic buffer
     void *data_;
     details::exchange_type type_;
     int position_;
     SQLSMALLINT odbcType_;
     SQLLEN valueLen_;
+
+    // If true, the column is not bound and its value is retrieved with
+    // SQLGetData() in post_fetch(), using a buffer of dataSize_ bytes for
+    // the non-string types.
+    bool lateBound_;
+    SQLLEN dataSize_;
 private:
     SOCI_NOT_COPYABLE(odbc_standard_into_type_backend)
 };
@@ -117,7 +151,7 @@ struct odbc_vector_into_type_backend : details::vector_into_type_backend,
 {
     odbc_vector_into_type_backend(odbc_statement_backend &st)
         : odbc_standard_type_backend_base(st),
-          data_(NULL), buf_(NULL), position_(0) {}
+          data_(NULL), buf_(NULL), position_(0), lateBound_(false) {}
 
     void define_by_pos(int &position,
         void *data, details::exchange_type type) override;
@@ -139,11 +173,17 @@ struct odbc_vector_into_type_backend : details::vector_into_type_backend,
     // IBM DB2 driver is not compliant to ODBC spec for indicators in 64bit
     // SQLLEN is still defined 32bit (int) but spec requires 64bit (long)
     inline SQLLEN get_sqllen_from_vector_at(std::size_t idx) const;
+    inline void set_sqllen_to_vector_at(std::size_t idx, SQLLEN val);
 
     // Rebind the single vector value at the given index to the first row.
     // Used when vector values are fetched by single row.
     void rebind_row(std::size_t rowInd);
 
+    // Retrieve the value of the late bound column for the current row of the
+    // cursor and store it in the vector element at rowInd, using the slot
+    // bufInd of buf_ if the type requires an intermediate buffer.
+    void get_late_bound_value(std::size_t rowInd, std::size_t bufInd);
+
     std::vector<SQLLEN> indHolderVec_;
     void *data_;
     char *buf_;              // generic buffer
@@ -151,6 +191,15 @@ struct odbc_vector_into_type_backend : details::vector_into_type_backend,
     std::size_t colSize_;    // size of the string column (used for strings)
     SQLSMALLINT odbcType_;
     int position_;
+
+    // If true, the column is not bound and its values are retrieved with
+    // get_late_bound_value() after each fetch.
+    bool lateBound_;
+
+private:
+    // Return the pointer to the vector element at the given index and fill
+    // in its size or return NULL if the type uses buf_.
+    void* get_element_ptr(std::size_t rowInd, SQLLEN &size);
 };
 
 struct odbc_standard_use_type_backend : details::standard_use_type_backend,
@@ -234,7 +283,8 @@ struct odbc_vector_use_type_backend : details::vector_use_type_backend,
 };
 
 struct odbc_session_backend;
-struct SOCI_ODBC_DECL odbc_statement_backend : details::statement_backend
+struct SOCI_ODBC_DECL odbc_statement_backend : details::statement_backend,
+                                               details::struct_binding_backend
 {
     odbc_statement_backend(odbc_session_backend &session);
 
@@ -244,6 +294,7 @@ struct SOCI_ODBC_DECL odbc_statement_backend : details::statement_backend
         details::statement_type eType) override;
 
     exec_fetch_result execute(int number) override;
+    exec_fetch_result execute_async(int number) override;
     exec_fetch_result fetch(int number) override;
 
     long long get_affected_rows() override;
@@ -261,11 +312,21 @@ struct SOCI_ODBC_DECL odbc_statement_backend : details::statement_backend
     // helper for defining into vector<string>
     std::size_t column_size(int position);
 
+    // Return true if the into element for the column at the given position
+    // must be late bound, i.e. retrieved using SQLGetData() instead of being
+    // bound with SQLBindCol(). This is always the case for long columns, but
+    // can also be necessary for the other ones, see the implementation.
+    bool use_late_binding(int colNum, bool isLongColumn);
+
     odbc_standard_into_type_backend * make_into_type_backend() override;
     odbc_standard_use_type_backend * make_use_type_backend() override;
     odbc_vector_into_type_backend * make_vector_into_type_backend() override;
     odbc_vector_use_type_backend * make_vector_use_type_backend() override;
 
+    void define_struct_by_pos(int &position, details::struct_vector_base &v) override;
+    void bind_struct_by_pos(int &position, details::struct_vector_base &v) override;
+    void clean_up_struct(details::struct_vector_base &v) override;
+
     odbc_session_backend &session_;
     SQLHSTMT hstmt_;
     SQLULEN numRowsFetched_;
@@ -283,9 +344,47 @@ struct SOCI_ODBC_DECL odbc_statement_backend : details::statement_backend
     // we're not using any vector "intos".
     std::vector<odbc_vector_into_type_backend*> intos_;
 
+    // Position of the first late bound column or 0 if there are none.
+    int firstLateBoundColumn_;
+
+    // Vectors of structs using row-wise binding for the columns and the
+    // parameters starting at the given positions, if any.
+    details::struct_vector_base *structInto_;
+    details::struct_vector_base *structUse_;
+    int structIntoPosition_;
+    int structUsePosition_;
+
+    // True if hstmt_ is prepared for query_ and can be reused for it.
+    bool prepared_;
+
+    // Number of parameter sets processed by the last execution.
+    SQLULEN rowsProcessed_;
+
+    // True if SQL_ATTR_ASYNC_ENABLE is on for hstmt_ and if SQLExecute()
+    // returned SQL_STILL_EXECUTING and must be called again.
+    bool asyncEnabled_;
+    bool asyncExecuting_;
+
 private:
+    // Common part of execute() and execute_async().
+    exec_fetch_result do_execute(int number, bool async);
+
+    // Switch hstmt_ back to synchronous mode if necessary.
+    void disable_async();
+
     // fetch() helper wrapping SQLFetch() call for the given range of rows.
     exec_fetch_result do_fetch(int beginRow, int endRow);
+
+    // Helpers binding all the fields of structInto_ or structUse_, row-wise.
+    void bind_struct_columns(SQLULEN rows);
+    void bind_struct_parameters();
+
+    // Adjust the indicators of the fetched structs if necessary.
+    void fix_struct_indicators();
+
+    // Return the C and SQL types to use for the given struct field.
+    void get_struct_field_types(details::struct_field const &field,
+                                SQLSMALLINT &cType, SQLSMALLINT &sqlType) const;
 };
 
 struct SOCI_ODBC_DECL odbc_rowid_backend : details::rowid_backend
@@ -360,6 +459,26 @@ struct SOCI_ODBC_DECL odbc_session_backend : details::session_backend
     // Return full ODBC connection string.
     std::string get_connection_string() const { return connection_string_; }
 
+    // Return the SQL_GD_XXX bit mask describing the driver support for
+    // SQLGetData() extensions.
+    SQLUINTEGER get_data_extensions() const;
+
+    // Return a statement handle, reusing one of the previously released
+    // handles if possible.
+    SQLHSTMT acquire_statement();
+
+    // Return the handle previously prepared for the given query, removing it
+    // from the cache, or NULL if there is no such handle.
+    SQLHSTMT get_cached_statement(std::string const & query);
+
+    // Give back the handle which is not used any more, together with the
+    // query it is prepared for or an empty string if it isn't prepared. The
+    // handle is reset and kept for reuse if possible or freed otherwise.
+    void release_statement(std::string const & query, SQLHSTMT hstmt);
+
+    // Free all the handles kept for reuse.
+    void clear_statement_cache();
+
     SQLHENV henv_;
     SQLHDBC hdbc_;
 
@@ -367,6 +486,29 @@ struct SOCI_ODBC_DECL odbc_session_backend : details::session_backend
 
 private:
     mutable database_product product_;
+    mutable SQLUINTEGER dataExtensions_;
+    mutable bool dataExtensionsKnown_;
+
+    // Keep the reset handle in the free list if there is space in it or
+    // free it otherwise.
+    void add_free_statement(SQLHSTMT hstmt);
+
+    // Move all the handles from the prepared statements cache to the free
+    // list.
+    void forget_prepared_statements();
+
+    // The maximal number of prepared statements kept in the cache, 0 if
+    // disabled.
+    std::size_t statementCacheSize_;
+
+    // The cached prepared statements, the most recently used ones first, and
+    // the index allowing to find them by their query.
+    typedef std::list<std::pair<std::string, SQLHSTMT> > statement_cache_list;
+    statement_cache_list statementCache_;
+    std::map<std::string, statement_cache_list::iterator> statementCacheIndex_;
+
+    // Reset handles which are not prepared for any query.
+    std::vector<SQLHSTMT> freeStatements_;
 };
 
 class SOCI_ODBC_DECL odbc_soci_error : public soci_error
@@ -578,6 +720,18 @@ inline SQLLEN odbc_vector_into_type_backend::get_sqllen_from_vector_at(std::size
     return indHolderVec_[idx];
 }
 
+inline void odbc_vector_into_type_backend::set_sqllen_to_vector_at(std::size_t idx, SQLLEN val)
+{
+    if (requires_noncompliant_32bit_sqllen())
+    {
+        reinterpret_cast<int*>(&indHolderVec_[0])[idx] = static_cast<int>(val);
+    }
+    else
+    {
+        indHolderVec_[idx] = val;
+    }
+}
+
 inline void odbc_vector_use_type_backend::set_sqllen_from_vector_at(const std::size_t idx, const SQLLEN val)
 {
     if (requires_noncompliant_32bit_sqllen())
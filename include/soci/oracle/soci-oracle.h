@@ -41,6 +41,9 @@ public:
 };
 
 
+// Number of rows prefetched by default when fetching rows one by one.
+ub4 const oracle_default_prefetch_rows = 100;
+
 struct oracle_statement_backend;
 struct oracle_standard_into_type_backend : details::standard_into_type_backend
 {
@@ -226,6 +229,9 @@ struct SOCI_ORACLE_DECL oracle_statement_backend : details::statement_backend
     int get_number_of_rows() override;
     std::string get_parameter_name(int index) const override;
 
+    bool collect_bulk_errors(bool collect) override;
+    std::vector<bulk_error> get_bulk_errors() override;
+
     std::string rewrite_for_procedure_call(std::string const &query) override;
 
     int prepare_for_describe() override;
@@ -241,13 +247,39 @@ struct SOCI_ORACLE_DECL oracle_statement_backend : details::statement_backend
     oracle_vector_into_type_backend * make_vector_into_type_backend() override;
     oracle_vector_use_type_backend * make_vector_use_type_backend() override;
 
+    // Set the number of rows or the amount of memory used for prefetching
+    // the rows of the result set, overriding the session defaults. 0 disables
+    // prefetching or the memory limit respectively.
+    void set_prefetch_rows(ub4 rows);
+    void set_prefetch_memory(ub4 bytes);
+
     oracle_session_backend &session_;
 
     OCIStmt *stmtp_;
 
+    ub4 prefetchRows_;
+    ub4 prefetchMemory_;
+
     bool boundByName_;
     bool boundByPos_;
+    bool hasVectorUseElements_;
     bool noData_;
+
+    // True if stmtp_ was obtained from OCIStmtPrepare2() and must be released
+    // using OCIStmtRelease() instead of being freed.
+    bool fromCache_;
+
+    // If true, DML statements are executed in OCI_BATCH_ERRORS mode and the
+    // errors for the individual rows are stored in bulkErrors_.
+    bool collectBulkErrors_;
+    std::vector<bulk_error> bulkErrors_;
+
+private:
+    void free_handle();
+    void set_prefetch_attr(ub4 attr, ub4 value);
+
+    // Fill bulkErrors_ after executing in OCI_BATCH_ERRORS mode.
+    void read_bulk_errors();
 };
 
 struct SOCI_ORACLE_DECL oracle_rowid_backend : details::rowid_backend
@@ -317,7 +349,10 @@ struct SOCI_ORACLE_DECL oracle_session_backend : details::session_backend
         int mode,
         bool decimals_as_strings = false,
         int charset = 0,
-        int ncharset = 0);
+        int ncharset = 0,
+        int stmtCacheSize = 0,
+        int prefetchRows = oracle_default_prefetch_rows,
+        int prefetchMemory = 0);
 
     ~oracle_session_backend() override;
 
@@ -458,6 +493,14 @@ struct SOCI_ORACLE_DECL oracle_session_backend : details::session_backend
 
     bool get_option_decimals_as_strings() { return decimals_as_strings_; }
 
+    // Return the size of the OCI statement cache, 0 if it is not used.
+    ub4 get_statement_cache_size() const { return stmtCacheSize_; }
+
+    // Return the default number of rows and amount of memory used for
+    // prefetching by the statements of this session.
+    ub4 get_prefetch_rows() const { return prefetchRows_; }
+    ub4 get_prefetch_memory() const { return prefetchMemory_; }
+
     // Return either SQLT_FLT or SQLT_BDOUBLE as the type to use when binding
     // values of C type "double" (the latter is preferable but might not be
     // always available).
@@ -469,6 +512,9 @@ struct SOCI_ORACLE_DECL oracle_session_backend : details::session_backend
     OCISvcCtx *svchp_;
     OCISession *usrhp_;
     bool decimals_as_strings_;
+    ub4 stmtCacheSize_;
+    ub4 prefetchRows_;
+    ub4 prefetchMemory_;
 };
 
 struct oracle_backend_factory : backend_factory
@@ -0,0 +1,404 @@
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef SOCI_POSTGRESQL_ARRAY_EXCHANGE_H_INCLUDED
+#define SOCI_POSTGRESQL_ARRAY_EXCHANGE_H_INCLUDED
+
+#include "soci/error.h"
+#include "soci/into-type.h"
+#include "soci/use-type.h"
+// std
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// This header provides use_array() and into_array() functions allowing to
+// exchange a std::vector<T> with a single PostgreSQL array value, e.g.
+//
+//      std::vector<int> ids = ...;
+//      sql << "select name from person where id = ANY(:ids)", use_array(ids);
+//
+// The arrays are transferred using their text representation, which is built
+// and parsed by the functions below.
+
+namespace soci
+{
+
+namespace details
+{
+
+namespace postgresql_array
+{
+
+// Traits class used to convert array elements of type T to and from their
+// text representation. It is only defined for the supported element types.
+template <typename T, typename Enable = void>
+struct element;
+
+template <typename T>
+struct element<T,
+    typename std::enable_if<std::is_integral<T>::value &&
+                            !std::is_same<T, bool>::value &&
+                            !std::is_same<T, char>::value>::type>
+{
+    static void append(std::string & s, T value)
+    {
+        s += std::to_string(value);
+    }
+
+    static T parse(std::string const & s)
+    {
+        char * end;
+        errno = 0;
+        if (std::is_signed<T>::value)
+        {
+            long long const value = std::strtoll(s.c_str(), &end, 10);
+            if (errno == 0 && *end == '\0' && !s.empty() &&
+                value >= static_cast<long long>(std::numeric_limits<T>::min()) &&
+                value <= static_cast<long long>(std::numeric_limits<T>::max()))
+            {
+                return static_cast<T>(value);
+            }
+        }
+        else
+        {
+            unsigned long long const value = std::strtoull(s.c_str(), &end, 10);
+            if (errno == 0 && *end == '\0' && !s.empty() && s[0] != '-' &&
+                value <= static_cast<unsigned long long>(std::numeric_limits<T>::max()))
+            {
+                return static_cast<T>(value);
+            }
+        }
+
+        throw soci_error("Cannot convert array element \"" + s + "\" to integer.");
+    }
+};
+
+template <typename T>
+struct element<T,
+    typename std::enable_if<std::is_floating_point<T>::value>::type>
+{
+    static void append(std::string & s, T value)
+    {
+        std::ostringstream oss;
+        oss.imbue(std::locale::classic());
+        oss.precision(std::numeric_limits<T>::max_digits10);
+        oss << value;
+        s += oss.str();
+    }
+
+    static T parse(std::string const & s)
+    {
+        // Special values are output by PostgreSQL in a form that can't be
+        // parsed by the standard streams.
+        if (s == "NaN")
+            return std::numeric_limits<T>::quiet_NaN();
+        if (s == "Infinity")
+            return std::numeric_limits<T>::infinity();
+        if (s == "-Infinity")
+            return -std::numeric_limits<T>::infinity();
+
+        std::istringstream iss(s);
+        iss.imbue(std::locale::classic());
+
+        T value;
+        iss >> value;
+        if (!iss || !iss.eof())
+        {
+            throw soci_error("Cannot convert array element \"" + s + "\" to floating point number.");
+        }
+
+        return value;
+    }
+};
+
+template <>
+struct element<bool>
+{
+    static void append(std::string & s, bool value)
+    {
+        s += value ? 't' : 'f';
+    }
+
+    static bool parse(std::string const & s)
+    {
+        if (s == "t")
+            return true;
+        if (s == "f")
+            return false;
+
+        throw soci_error("Cannot convert array element \"" + s + "\" to boolean.");
+    }
+};
+
+template <>
+struct element<std::string>
+{
+    static void append(std::string & s, std::string const & value)
+    {
+        // Always quote the strings, this is the simplest way to ensure that
+        // the elements containing special characters or equal to NULL are
+        // handled correctly.
+        s += '"';
+        for (std::string::const_iterator it = value.begin(); it != value.end(); ++it)
+        {
+            if (*it == '"' || *it == '\\')
+            {
+                s += '\\';
+            }
+
+            s += *it;
+        }
+        s += '"';
+    }
+
+    static std::string parse(std::string const & s)
+    {
+        return s;
+    }
+};
+
+// Split the text representation of a one-dimensional array into its
+// elements, which are unquoted and unescaped.
+inline void split(std::string const & text, std::vector<std::string> & elements)
+{
+    elements.clear();
+
+    std::string::const_iterator it = text.begin();
+    std::string::const_iterator const end = text.end();
+
+    // Skip the dimensions decoration, e.g. "[0:2]=", which is only output
+    // when the lower bound is not 1 and is irrelevant for us.
+    if (it != end && *it == '[')
+    {
+        while (it != end && *it != '=')
+            ++it;
+        if (it != end)
+            ++it;
+    }
+
+    if (it == end || *it != '{')
+    {
+        throw soci_error("Cannot parse array value \"" + text + "\".");
+    }
+
+    ++it;
+    if (it != end && *it == '}')
+    {
+        return;
+    }
+
+    for (;;)
+    {
+        if (it == end)
+        {
+            throw soci_error("Unexpected end of array value \"" + text + "\".");
+        }
+
+        std::string elem;
+        if (*it == '"')
+        {
+            for (++it; it != end && *it != '"'; ++it)
+            {
+                if (*it == '\\' && ++it == end)
+                    break;
+
+                elem += *it;
+            }
+
+            if (it == end)
+            {
+                throw soci_error("Unterminated quoted element in array value \"" + text + "\".");
+            }
+
+            ++it;
+        }
+        else if (*it == '{')
+        {
+            throw soci_error("Multidimensional arrays are not supported.");
+        }
+        else
+        {
+            for (; it != end && *it != ',' && *it != '}'; ++it)
+            {
+                elem += *it;
+            }
+
+            if (elem == "NULL")
+            {
+                throw soci_error("Null array elements are not supported.");
+            }
+        }
+
+        elements.push_back(elem);
+
+        if (it == end)
+        {
+            throw soci_error("Unexpected end of array value \"" + text + "\".");
+        }
+
+        if (*it == '}')
+        {
+            break;
+        }
+
+        if (*it != ',')
+        {
+            throw soci_error("Cannot parse array value \"" + text + "\".");
+        }
+
+        ++it;
+    }
+}
+
+template <typename T>
+std::string format(std::vector<T> const & v)
+{
+    std::string text("{");
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        if (i != 0)
+        {
+            text += ',';
+        }
+
+        element<T>::append(text, v[i]);
+    }
+    text += '}';
+
+    return text;
+}
+
+template <typename T>
+void parse(std::string const & text, std::vector<T> & v)
+{
+    std::vector<std::string> elements;
+    split(text, elements);
+
+    v.clear();
+    v.reserve(elements.size());
+    for (std::size_t i = 0; i != elements.size(); ++i)
+    {
+        v.push_back(element<T>::parse(elements[i]));
+    }
+}
+
+// This class is used to ensure that the text buffer is constructed before
+// the base into_type or use_type class referencing it.
+struct text_holder
+{
+    text_holder() : ownInd_(i_ok) {}
+
+    std::string text_;
+    indicator ownInd_;
+};
+
+} // namespace postgresql_array
+
+template <typename T>
+class postgresql_array_into_type
+    : private postgresql_array::text_holder,
+      public into_type<std::string>
+{
+public:
+    explicit postgresql_array_into_type(std::vector<T> & v)
+        : into_type<std::string>(text_, ownInd_), v_(v), ind_(ownInd_),
+          hasUserInd_(false)
+    {
+    }
+
+    postgresql_array_into_type(std::vector<T> & v, indicator & ind)
+        : into_type<std::string>(text_, ind), v_(v), ind_(ind),
+          hasUserInd_(true)
+    {
+    }
+
+private:
+    void convert_from_base() override
+    {
+        if (ind_ == i_null)
+        {
+            if (!hasUserInd_)
+            {
+                throw soci_error("Null value fetched and no indicator defined.");
+            }
+
+            v_.clear();
+            return;
+        }
+
+        postgresql_array::parse(text_, v_);
+    }
+
+    std::vector<T> & v_;
+    indicator & ind_;
+    bool const hasUserInd_;
+
+    SOCI_NOT_COPYABLE(postgresql_array_into_type)
+};
+
+template <typename T>
+class postgresql_array_use_type
+    : private postgresql_array::text_holder,
+      public use_type<std::string>
+{
+public:
+    postgresql_array_use_type(std::vector<T> const & v, std::string const & name)
+        : use_type<std::string>(text_, ownInd_, name), v_(v)
+    {
+    }
+
+private:
+    void convert_to_base() override
+    {
+        text_ = postgresql_array::format(v_);
+    }
+
+    std::vector<T> const & v_;
+
+    SOCI_NOT_COPYABLE(postgresql_array_use_type)
+};
+
+} // namespace details
+
+// Bind the entire vector as a single array parameter.
+//
+// As with soci::use(), temporary vectors can't be used here.
+template <typename T>
+details::use_type_ptr use_array(std::vector<T> && v,
+    std::string const & name = std::string()) = delete;
+
+template <typename T>
+details::use_type_ptr use_array(std::vector<T> const & v,
+    std::string const & name = std::string())
+{
+    return details::use_type_ptr(
+        new details::postgresql_array_use_type<T>(v, name));
+}
+
+// Retrieve the value of an array column into the vector.
+template <typename T>
+details::into_type_ptr into_array(std::vector<T> & v)
+{
+    return details::into_type_ptr(
+        new details::postgresql_array_into_type<T>(v));
+}
+
+template <typename T>
+details::into_type_ptr into_array(std::vector<T> & v, indicator & ind)
+{
+    return details::into_type_ptr(
+        new details::postgresql_array_into_type<T>(v, ind));
+}
+
+} // namespace soci
+
+#endif // SOCI_POSTGRESQL_ARRAY_EXCHANGE_H_INCLUDED
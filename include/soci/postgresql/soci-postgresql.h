@@ -20,6 +20,7 @@
 #include <soci/soci-backend.h>
 #include "soci/connection-parameters.h"
 #include <libpq-fe.h>
+#include <string>
 #include <vector>
 #include <unordered_map>
 
@@ -95,6 +96,21 @@ public:
     // careful to avoid really modifying it.
     PGresult* get_result() const { return result_; }
 
+    // Give up the ownership of the result without freeing it and return it,
+    // the caller becomes responsible for calling PQclear() on it.
+    PGresult* release()
+    {
+        PGresult* const result = result_;
+        result_ = NULL;
+        return result;
+    }
+
+    // Get the session backend this result was created for.
+    postgresql_session_backend & get_session_backend() const
+    {
+        return sessionBackend_;
+    }
+
     // Dtor frees the result.
     ~postgresql_result() { clear(); }
 
@@ -279,10 +295,43 @@ struct SOCI_POSTGRESQL_DECL postgresql_statement_backend : details::statement_ba
     postgresql_vector_into_type_backend * make_vector_into_type_backend() override;
     postgresql_vector_use_type_backend * make_vector_use_type_backend() override;
 
+    // Enable or disable using a server-side cursor for retrieving the rows
+    // of the query results, see the "cursors" connection option in the
+    // documentation. This must be called before executing the statement.
+    //
+    // Unlike the connection option, which only affects the statements with
+    // vector into elements, enabling the cursor explicitly makes it used for
+    // the statements with single into elements too, e.g. for rowset<row>.
+    void set_use_cursor(bool useCursor)
+    {
+        use_cursor_ = useCursor;
+        use_cursor_explicitly_ = useCursor;
+    }
+
+    // Declare the cursor for query_ and fetch its first batch of rows.
+    void declare_cursor(std::vector<char *> const & paramValues, int number);
+
+    // Fetch up to the given number of rows from the cursor, closing it if
+    // there are no more rows, and return the result containing them.
+    PGresult * fetch_from_cursor(int number);
+
+    // Close the cursor, if any.
+    void close_cursor();
+
+    // Retrieve the next results from the server in single-row mode until
+    // the given number of rows is available in result_ or there are no more
+    // rows. Used by fetch() in single-row mode only.
+    exec_fetch_result fetch_single_rows(int number);
+
     postgresql_session_backend & session_;
 
     bool single_row_mode_;
 
+    bool use_cursor_;
+    bool use_cursor_explicitly_; // if true, use cursor even for single intos
+    std::string cursorName_; // name of the currently open cursor, if any
+    int cursorTransaction_;  // value of transactionsEnded_ when it was opened
+
     details::postgresql_result result_;
     std::string query_;
     details::statement_type stType_;
@@ -295,6 +344,8 @@ struct SOCI_POSTGRESQL_DECL postgresql_statement_backend : details::statement_ba
     int currentRow_;    // "current" row number to consume in postFetch
     int rowsToConsume_; // number of rows to be consumed in postFetch
 
+    bool endOfRows_;    // true if all rows were received in single-row mode
+
     bool justDescribed_; // to optimize row description with immediately
                          // following actual statement execution
 
@@ -311,11 +362,6 @@ struct SOCI_POSTGRESQL_DECL postgresql_statement_backend : details::statement_ba
 
     typedef std::map<std::string, char **> UseByNameBuffersMap;
     UseByNameBuffersMap useByNameBuffers_;
-
-    // the following map is used to keep the results of column
-    // type queries with custom types
-    typedef std::unordered_map<unsigned long, char> CategoryByColumnOID;
-    CategoryByColumnOID categoryByColumnOID_;
 };
 
 struct SOCI_POSTGRESQL_DECL postgresql_rowid_backend : details::rowid_backend
@@ -382,6 +428,17 @@ private:
     void clone();
 };
 
+// Asynchronous notification received from the server, see
+// postgresql_session_backend::listen().
+struct postgresql_notification
+{
+    postgresql_notification() : pid(0) {}
+
+    std::string channel; // name of the channel the notification was sent to
+    std::string payload; // possibly empty payload string
+    int pid;             // process ID of the notifying server process
+};
+
 struct SOCI_POSTGRESQL_DECL postgresql_session_backend : details::session_backend
 {
     explicit postgresql_session_backend(connection_parameters const & parameters);
@@ -413,13 +470,49 @@ struct SOCI_POSTGRESQL_DECL postgresql_session_backend : details::session_backen
 
     std::string get_next_statement_name();
 
+    // Return the category of the type with the given OID, as stored in the
+    // typcategory column of pg_type, or '\0' if it couldn't be determined.
+    // The categories are cached, so the server is queried at most once per
+    // type and session.
+    char get_type_category(unsigned long typeOid);
+
+    // Retrieve the categories of all non built-in types in a single query.
+    void preload_type_categories();
+
+    // Start or stop listening for notifications on the given channel.
+    void listen(std::string const & channel);
+    void unlisten(std::string const & channel);
+
+    // Return the next notification if there is one already available
+    // without blocking. Returns false if there are no notifications.
+    bool get_notification(postgresql_notification & notification);
+
+    // Wait for the next notification for at most the given timeout in
+    // milliseconds, or indefinitely if it is negative. Returns false if no
+    // notification was received during this time.
+    bool wait_for_notification(postgresql_notification & notification,
+        int timeoutMs = -1);
+
+    // Return the socket used for the connection to the server, which can be
+    // used to integrate waiting for notifications into an external event
+    // loop: when it becomes readable, get_notification() should be called
+    // until it returns false.
+    int get_socket() const { return PQsocket(conn_); }
+
     std::string get_table_names_query() const override;
     std::string get_column_descriptions_query() const override;
 
     int statementCount_;
+    int transactionsEnded_; // number of commits and rollbacks done so far
     bool single_row_mode_;
+    bool use_cursors_;
     PGconn * conn_;
     connection_parameters connectionParameters_;
+
+    // the following map is used to keep the results of type category
+    // queries for custom types, it is cleared when reconnecting
+    typedef std::unordered_map<unsigned long, char> CategoryByTypeOID;
+    CategoryByTypeOID categoryByTypeOID_;
 };
 
 
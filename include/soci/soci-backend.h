@@ -50,6 +50,15 @@ enum data_type
 // the enum type for indicator variables
 enum indicator { i_ok, i_null, i_truncated };
 
+// Error for a single row of a bulk operation, returned by
+// statement::get_bulk_errors() if collect_bulk_errors() was used.
+struct bulk_error
+{
+    std::size_t row;        // 0-based index of the row in the bound vectors
+    int code;               // backend-specific error code
+    std::string message;
+};
+
 class session;
 class failover_callback;
 
@@ -78,6 +87,10 @@ enum exchange_type
     x_xmltype,
     x_longstring,
 
+    // Binary value stored in std::vector<uint8_t>, only used with vectors
+    // of such values in bulk operations.
+    x_binary,
+
     // Deprecated synonyms.
     x_short = x_int16,
     x_integer = x_int32,
@@ -217,6 +230,63 @@ private:
     SOCI_NOT_COPYABLE(vector_use_type_backend)
 };
 
+// row-wise binding of vectors of structs, see soci/struct-exchange.h
+
+// Description of a struct member bound to a column or a parameter.
+struct struct_field
+{
+    exchange_type type_;        // x_char is used for the char arrays
+    std::size_t offset_;        // offset of the member in the struct
+    std::size_t size_;          // size of the member
+    std::ptrdiff_t indOffset_;  // offset of the indicator member or -1
+    std::size_t indSize_;       // size of the indicator member
+};
+
+// Type-erased vector of structs used by the backends.
+class struct_vector_base
+{
+public:
+    std::vector<struct_field> const & fields() const { return fields_; }
+    std::size_t element_size() const { return elementSize_; }
+
+    virtual std::size_t vector_size() const = 0;
+    virtual void vector_resize(std::size_t sz) = 0;
+
+    // Pointer to the first element of the vector, which must not be empty.
+    virtual void * vector_data() = 0;
+
+protected:
+    struct_vector_base(std::vector<struct_field> const & fields,
+                       std::size_t elementSize)
+        : fields_(fields), elementSize_(elementSize) {}
+
+    ~struct_vector_base() {}
+
+private:
+    std::vector<struct_field> const fields_;
+    std::size_t const elementSize_;
+};
+
+// Interface implemented by the statement backends supporting the row-wise
+// binding of vectors of structs.
+class struct_binding_backend
+{
+public:
+    // Define the columns starting at the given position as corresponding to
+    // the fields of the structs in this vector.
+    virtual void define_struct_by_pos(int & position, struct_vector_base & v) = 0;
+
+    // Bind the parameters starting at the given position to the fields of
+    // the structs in this vector.
+    virtual void bind_struct_by_pos(int & position, struct_vector_base & v) = 0;
+
+    // Forget about the vector previously passed to one of the functions above.
+    virtual void clean_up_struct(struct_vector_base & v) = 0;
+
+protected:
+    ~struct_binding_backend() {}
+};
+
 // polymorphic statement backend
 
 class statement_backend
@@ -233,15 +303,37 @@ public:
     enum exec_fetch_result
     {
         ef_success,
-        ef_no_data
+        ef_no_data,
+        ef_still_executing // Only returned by execute_async().
     };
 
     virtual exec_fetch_result execute(int number) = 0;
+
+    // Start or continue executing the statement without blocking. If this
+    // returns ef_still_executing, it must be called again with the same
+    // argument later until it returns something else. The default version
+    // just executes the statement synchronously.
+    virtual exec_fetch_result execute_async(int number)
+    {
+        return execute(number);
+    }
+
     virtual exec_fetch_result fetch(int number) = 0;
 
     virtual long long get_affected_rows() = 0;
     virtual int get_number_of_rows() = 0;
 
+    // Enable or disable executing all the rows of bulk operations even if
+    // some of them fail and collecting the errors for them instead of
+    // stopping at the first one. Returns false if this is not supported.
+    virtual bool collect_bulk_errors(bool collect) { return !collect; }
+
+    // Return the errors collected during the last execution.
+    virtual std::vector<bulk_error> get_bulk_errors()
+    {
+        return std::vector<bulk_error>();
+    }
+
     virtual std::string get_parameter_name(int index) const = 0;
 
     virtual std::string rewrite_for_procedure_call(std::string const& query) = 0;
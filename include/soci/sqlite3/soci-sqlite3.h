@@ -18,6 +18,10 @@
 
 #include <cstdarg>
 #include <cstdint>
+#include <list>
+#include <map>
+#include <string>
+#include <utility>
 #include <vector>
 #include <soci/soci-backend.h>
 #include <soci/trivial-blob-backend.h>
@@ -135,7 +139,7 @@ struct sqlite3_standard_use_type_backend : details::standard_use_type_backend
 struct sqlite3_vector_use_type_backend : details::vector_use_type_backend
 {
     sqlite3_vector_use_type_backend(sqlite3_statement_backend &st)
-        : statement_(st), data_(0), type_(), position_(0)
+        : statement_(st), data_(0), type_(), position_(0), ind_(0)
     {
     }
 
@@ -150,12 +154,21 @@ struct sqlite3_vector_use_type_backend : details::vector_use_type_backend
 
     void clean_up() override;
 
+    // Bind the element of the vector at the given row directly to the
+    // statement parameter, this is called for each row of a bulk operation.
+    void bind_row(int row);
+
     sqlite3_statement_backend &statement_;
 
     void *data_;
     details::exchange_type type_;
     int position_;
     std::string name_;
+
+    indicator const *ind_;
+
+    // buffer used for the text representation of std::tm values
+    char dateBuffer_[20];
 };
 
 struct sqlite3_column_buffer
@@ -193,6 +206,25 @@ struct sqlite3_column
 typedef std::vector<sqlite3_column> sqlite3_row;
 typedef std::vector<sqlite3_row> sqlite3_recordset;
 
+// Storage for the text and blob cells of the rows fetched in a single batch.
+//
+// Memory is handed out from a few large blocks which are never reallocated,
+// so the returned pointers remain valid until the next reset(), which makes
+// all the memory available again without freeing it.
+class sqlite3_column_arena
+{
+public:
+    sqlite3_column_arena() : current_(0), used_(0) {}
+
+    char * allocate(std::size_t size);
+    void reset();
+
+private:
+    std::vector<std::vector<char> > blocks_;
+    std::size_t current_;
+    std::size_t used_;
+};
+
 
 struct sqlite3_column_info
 {
@@ -236,8 +268,15 @@ struct SOCI_SQLITE3_DECL sqlite3_statement_backend : details::statement_backend
 
     sqlite3_session_backend &session_;
     sqlite_api::sqlite3_stmt *stmt_;
+    std::string query_; // the query used to prepare stmt_
+
+    // The result of sqlite3_step() called by describe_column() which hasn't
+    // been consumed by fetching the row yet, or 0.
+    int pendingStep_;
     sqlite3_recordset dataCache_;
+    sqlite3_column_arena dataArena_; // owns the buffers of dataCache_ cells
     sqlite3_recordset useData_;
+    std::vector<sqlite3_vector_use_type_backend*> vectorUses_;
     bool databaseReady_;
     bool boundByName_;
     bool boundByPos_;
@@ -248,9 +287,11 @@ struct SOCI_SQLITE3_DECL sqlite3_statement_backend : details::statement_backend
     long long rowsAffectedBulk_; // number of rows affected by the last bulk operation
 
 private:
+    int step();
     exec_fetch_result load_rowset(int totalRows);
     exec_fetch_result load_one();
     exec_fetch_result bind_and_execute(int number);
+    void bind_vector_uses(int row);
 };
 
 struct SOCI_SQLITE3_DECL sqlite3_rowid_backend : details::rowid_backend
@@ -262,13 +303,48 @@ struct SOCI_SQLITE3_DECL sqlite3_rowid_backend : details::rowid_backend
     unsigned long value_;
 };
 
+// By default, the BLOB data is stored in memory, but it can also be accessed
+// incrementally in the database, without loading it entirely, after calling
+// open() for an existing row. Its size can't be changed in this case.
 struct SOCI_SQLITE3_DECL sqlite3_blob_backend : details::trivial_blob_backend
 {
     sqlite3_blob_backend(sqlite3_session_backend &session);
 
     ~sqlite3_blob_backend() override;
 
+    std::size_t get_len() override;
+
+    std::size_t read_from_start(void* buf, std::size_t toRead,
+        std::size_t offset = 0) override;
+
+    std::size_t write_from_start(const void* buf, std::size_t toWrite,
+        std::size_t offset = 0) override;
+
+    std::size_t append(void const* buf, std::size_t toWrite) override;
+
+    void trim(std::size_t newLen) override;
+
+    // Replaces the base class function to close the BLOB if it was opened.
+    std::size_t set_data(void const* buf, std::size_t toWrite);
+
     void ensure_buffer_initialized();
+
+    // Open the BLOB stored in the given column of the row with the given
+    // rowid for incremental I/O, closing the previously opened one, if any.
+    void open(std::string const &table, std::string const &column,
+              sqlite_api::sqlite3_int64 rowid, bool readWrite = false,
+              std::string const &database = "main");
+
+    // Switch the opened BLOB to another row of the same table.
+    void reopen(sqlite_api::sqlite3_int64 rowid);
+
+    // Close the BLOB opened for incremental I/O, if any, the BLOB becomes
+    // empty after doing this.
+    void close();
+
+    bool is_open() const { return blob_ != NULL; }
+
+    sqlite_api::sqlite3_blob *blob_;
 };
 
 struct SOCI_SQLITE3_DECL sqlite3_session_backend : details::session_backend
@@ -354,11 +430,33 @@ struct SOCI_SQLITE3_DECL sqlite3_session_backend : details::session_backend
         }
     }
 
+    // Return the statement previously prepared for the given query, removing
+    // it from the cache, or NULL if there is no such statement.
+    sqlite_api::sqlite3_stmt * get_cached_statement(std::string const & query);
+
+    // Put the statement prepared for the given query into the cache, which
+    // takes ownership of it, or finalize it if the cache is disabled.
+    void release_statement(std::string const & query,
+                           sqlite_api::sqlite3_stmt * stmt);
+
+    // Finalize all the cached statements.
+    void clear_statement_cache();
+
     sqlite_api::sqlite3 *conn_;
 
     // This flag is set to true if the internal sqlite_sequence table exists in
     // the database.
     bool sequence_table_exists_;
+
+    // The maximal number of statements kept in the cache, 0 if disabled.
+    std::size_t statementCacheSize_;
+
+    // The cached statements, the most recently used ones first, and the index
+    // allowing to find them by their query.
+    typedef std::list<std::pair<std::string, sqlite_api::sqlite3_stmt *> >
+        statement_cache_list;
+    statement_cache_list statementCache_;
+    std::map<std::string, statement_cache_list::iterator> statementCacheIndex_;
 };
 
 struct sqlite3_backend_factory : backend_factory
@@ -0,0 +1,70 @@
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef SOCI_SQLITE3_WAL_POOL_H_INCLUDED
+#define SOCI_SQLITE3_WAL_POOL_H_INCLUDED
+
+#include "soci/sqlite3/soci-sqlite3.h"
+#include "soci/connection-parameters.h"
+#include "soci/connection-pool.h"
+// std
+#include <cstddef>
+#include <string>
+
+namespace soci
+{
+
+// Pool of connections to the same SQLite database file in WAL mode.
+//
+// In WAL mode readers don't block the writer and vice versa, but there can
+// still be only one writer at any time, so this pool contains a single
+// read-write session and the given number of sessions opened in read-only
+// mode. The sessions are leased from one of the two underlying pools
+// explicitly, depending on whether they will be used for writing or not:
+//
+//      sqlite3_wal_pool pool("db=app.db timeout=5 mmap_size=268435456", 4);
+//
+//      {
+//          session sql(pool.readers());
+//          sql << "select count(*) from t", into(count);
+//      }
+//
+//      {
+//          session sql(pool.writer());
+//          sql << "insert into t(x) values(:x)", use(x);
+//      }
+//
+// The writer session is opened first and switches the database to WAL mode,
+// which is persistent, before the readers are opened.
+class SOCI_SQLITE3_DECL sqlite3_wal_pool
+{
+public:
+    sqlite3_wal_pool(std::string const & connectString, std::size_t readersCount);
+    sqlite3_wal_pool(connection_parameters const & parameters,
+                     std::size_t readersCount);
+
+    // The pool containing the single read-write session.
+    connection_pool & writer() { return writer_; }
+
+    // The pool containing the read-only sessions.
+    connection_pool & readers() { return readers_; }
+
+    std::size_t readers_count() const { return readersCount_; }
+
+private:
+    void open(connection_parameters const & parameters);
+
+    std::size_t const readersCount_;
+
+    connection_pool writer_;
+    connection_pool readers_;
+
+    SOCI_NOT_COPYABLE(sqlite3_wal_pool)
+};
+
+} // namespace soci
+
+#endif // SOCI_SQLITE3_WAL_POOL_H_INCLUDED
@@ -64,7 +64,11 @@ public:
     void define_and_bind();
     void undefine_and_bind();
     bool execute(bool withDataExchange = false);
+    bool execute_async(bool withDataExchange, bool & gotData);
+    bool poll_execute(bool & gotData);
     long long get_affected_rows();
+    void collect_bulk_errors(bool collect);
+    std::vector<bulk_error> get_bulk_errors();
     bool fetch();
     void describe();
     void set_row(row * r);
@@ -150,6 +154,17 @@ private:
 
     bool alreadyDescribed_;
 
+    // True if the asynchronous execution was started but is not over yet
+    // and the number of rows passed to the backend when starting it.
+    bool asyncExecuting_;
+    int asyncNum_;
+
+    // Helpers of execute() and execute_async() doing everything before and
+    // after executing the statement in the backend.
+    int start_execution(bool withDataExchange);
+    bool finish_execution(statement_backend::exec_fetch_result res, int num);
+    bool poll_execution(bool & gotData);
+
     std::size_t intos_size();
     std::size_t uses_size();
     void pre_exec(int num);
@@ -222,11 +237,41 @@ public:
         return gotData_;
     }
 
+    // Start executing the statement without waiting for it to complete, if
+    // the backend supports it, otherwise this is the same as execute().
+    // Returns true if the execution is already over, in which case got_data()
+    // can be checked, or false if poll_execute() must be called until it
+    // returns true. No other operations can be done on the statement until
+    // then.
+    bool execute_async(bool withDataExchange = false)
+    {
+        return impl_->execute_async(withDataExchange, gotData_);
+    }
+
+    bool poll_execute()
+    {
+        return impl_->poll_execute(gotData_);
+    }
+
     long long get_affected_rows()
     {
         return impl_->get_affected_rows();
     }
 
+    // Execute all the rows of bulk operations even if some of them fail and
+    // collect the errors for them, which can be retrieved using
+    // get_bulk_errors() after execute(), instead of throwing an exception for
+    // the first failing row. Throws if not supported by the backend.
+    void collect_bulk_errors(bool collect = true)
+    {
+        impl_->collect_bulk_errors(collect);
+    }
+
+    std::vector<bulk_error> get_bulk_errors()
+    {
+        return impl_->get_bulk_errors();
+    }
+
     bool fetch()
     {
         gotData_ = impl_->fetch();
@@ -0,0 +1,284 @@
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef SOCI_STRUCT_EXCHANGE_H_INCLUDED
+#define SOCI_STRUCT_EXCHANGE_H_INCLUDED
+
+#include "soci/soci-backend.h"
+#include "soci/error.h"
+#include "soci/into-type.h"
+#include "soci/use-type.h"
+#include "soci/statement.h"
+// std
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// This header provides into_struct() and use_struct() functions allowing to
+// exchange a std::vector<T> of plain structs with the database using the
+// row-wise binding, i.e. letting the backend read and write the structs in
+// place instead of going through a separate vector for each column:
+//
+//      struct person
+//      {
+//          int32_t id;
+//          char name[32];
+//          SQLLEN nameInd;
+//      };
+//
+//      struct_fields<person> fields;
+//      fields.field(&person::id)
+//            .field(&person::name, &person::nameInd);
+//
+//      std::vector<person> people(100);
+//      statement st = (sql.prepare << "select id, name from person",
+//                      into_struct(people, fields));
+//      st.execute();
+//      while (st.fetch()) { ... }
+//
+// The members must be of fixed size integer types, double or arrays of char
+// for strings. The optional indicator members must have the native length
+// or indicator type of the backend (SQLLEN for ODBC and DB2) and are used
+// in the backend-specific way, e.g. contain SQL_NULL_DATA for NULL values.
+//
+// Only the backends implementing details::struct_binding_backend support it.
+
+namespace soci
+{
+
+namespace details
+{
+
+template <typename M>
+struct struct_field_traits;
+
+#define SOCI_STRUCT_FIELD_TRAITS(T, x) \
+    template <> \
+    struct struct_field_traits<T> \
+    { \
+        static exchange_type const x_type = x; \
+    }
+
+SOCI_STRUCT_FIELD_TRAITS(int8_t, x_int8);
+SOCI_STRUCT_FIELD_TRAITS(uint8_t, x_uint8);
+SOCI_STRUCT_FIELD_TRAITS(int16_t, x_int16);
+SOCI_STRUCT_FIELD_TRAITS(uint16_t, x_uint16);
+SOCI_STRUCT_FIELD_TRAITS(int32_t, x_int32);
+SOCI_STRUCT_FIELD_TRAITS(uint32_t, x_uint32);
+SOCI_STRUCT_FIELD_TRAITS(int64_t, x_int64);
+SOCI_STRUCT_FIELD_TRAITS(uint64_t, x_uint64);
+SOCI_STRUCT_FIELD_TRAITS(double, x_double);
+
+#undef SOCI_STRUCT_FIELD_TRAITS
+
+// Arrays of char are used for the strings, including the trailing NUL.
+template <std::size_t N>
+struct struct_field_traits<char[N]>
+{
+    static_assert(N > 1, "char arrays used for strings must have space for NUL");
+
+    static exchange_type const x_type = x_char;
+};
+
+inline struct_binding_backend & get_struct_binding_backend(statement_impl & st)
+{
+    struct_binding_backend * const
+        backEnd = dynamic_cast<struct_binding_backend *>(st.get_backend());
+    if (!backEnd)
+    {
+        throw soci_error("Row-wise binding of structs is not supported by this backend.");
+    }
+
+    return *backEnd;
+}
+
+} // namespace details
+
+// Mapping of the members of struct T to the consecutive columns of the
+// result set or parameters of the statement.
+template <typename T>
+class struct_fields
+{
+public:
+    static_assert(std::is_standard_layout<T>::value &&
+                  std::is_trivially_copyable<T>::value &&
+                  std::is_default_constructible<T>::value,
+                  "only plain structs can be used with row-wise binding");
+
+    template <typename M>
+    struct_fields & field(M T::* member)
+    {
+        return add_field<M>(offset_of(member), -1, 0);
+    }
+
+    template <typename M, typename I>
+    struct_fields & field(M T::* member, I T::* ind)
+    {
+        static_assert(std::is_integral<I>::value && std::is_signed<I>::value,
+                      "indicator member must be of signed integer type");
+
+        return add_field<M>(offset_of(member),
+                            static_cast<std::ptrdiff_t>(offset_of(ind)),
+                            sizeof(I));
+    }
+
+    std::vector<details::struct_field> const & get() const { return fields_; }
+
+private:
+    // Compute the offset of the member using a value-initialized T object,
+    // which is cheap and has no side effects for the plain structs.
+    template <typename M>
+    static std::size_t offset_of(M T::* member)
+    {
+        T const obj = T();
+        return static_cast<std::size_t>(
+            reinterpret_cast<char const *>(&(obj.*member)) -
+            reinterpret_cast<char const *>(&obj));
+    }
+
+    template <typename M>
+    struct_fields & add_field(std::size_t offset,
+                              std::ptrdiff_t indOffset, std::size_t indSize)
+    {
+        details::struct_field f;
+        f.type_ = details::struct_field_traits<M>::x_type;
+        f.offset_ = offset;
+        f.size_ = sizeof(M);
+        f.indOffset_ = indOffset;
+        f.indSize_ = indSize;
+        fields_.push_back(f);
+
+        return *this;
+    }
+
+    std::vector<details::struct_field> fields_;
+};
+
+namespace details
+{
+
+template <typename T>
+class struct_into_type : public into_type_base, public struct_vector_base
+{
+public:
+    struct_into_type(std::vector<T> & v, struct_fields<T> const & fields)
+        : struct_vector_base(fields.get(), sizeof(T)), v_(v), backEnd_(NULL)
+    {
+    }
+
+    void define(statement_impl & st, int & position) override
+    {
+        backEnd_ = &get_struct_binding_backend(st);
+        backEnd_->define_struct_by_pos(position, *this);
+    }
+
+    void pre_exec(int /* num */) override {}
+    void pre_fetch() override {}
+    void post_fetch(bool /* gotData */, bool /* calledFromFetch */) override {}
+
+    void clean_up() override
+    {
+        if (backEnd_)
+        {
+            backEnd_->clean_up_struct(*this);
+            backEnd_ = NULL;
+        }
+    }
+
+    std::size_t size() const override { return v_.size(); }
+    void resize(std::size_t sz) override { v_.resize(sz); }
+
+    std::size_t vector_size() const override { return v_.size(); }
+    void vector_resize(std::size_t sz) override { v_.resize(sz); }
+    void * vector_data() override { return &v_.at(0); }
+
+private:
+    std::vector<T> & v_;
+    struct_binding_backend * backEnd_;
+
+    SOCI_NOT_COPYABLE(struct_into_type)
+};
+
+template <typename T>
+class struct_use_type : public use_type_base, public struct_vector_base
+{
+public:
+    struct_use_type(std::vector<T> const & v, struct_fields<T> const & fields)
+        : struct_vector_base(fields.get(), sizeof(T)), v_(v), backEnd_(NULL)
+    {
+    }
+
+    void bind(statement_impl & st, int & position) override
+    {
+        backEnd_ = &get_struct_binding_backend(st);
+        backEnd_->bind_struct_by_pos(position, *this);
+    }
+
+    std::string get_name() const override { return std::string(); }
+
+    void dump_value(std::ostream & os) const override
+    {
+        os << "<vector of " << v_.size() << " structs>";
+    }
+
+    void pre_exec(int /* num */) override {}
+    void pre_use() override {}
+    void post_use(bool /* gotData */) override {}
+
+    void clean_up() override
+    {
+        if (backEnd_)
+        {
+            backEnd_->clean_up_struct(*this);
+            backEnd_ = NULL;
+        }
+    }
+
+    std::size_t size() const override { return v_.size(); }
+
+    std::size_t vector_size() const override { return v_.size(); }
+    void vector_resize(std::size_t /* sz */) override
+    {
+        throw soci_error("Vector of structs used as input can't be resized.");
+    }
+
+    // The backends only read the data of the input vector.
+    void * vector_data() override { return const_cast<T *>(&v_.at(0)); }
+
+private:
+    std::vector<T> const & v_;
+    struct_binding_backend * backEnd_;
+
+    SOCI_NOT_COPYABLE(struct_use_type)
+};
+
+} // namespace details
+
+template <typename T>
+details::into_type_ptr into_struct(std::vector<T> & v,
+                                   struct_fields<T> const & fields)
+{
+    return details::into_type_ptr(new details::struct_into_type<T>(v, fields));
+}
+
+// As with soci::use(), temporary vectors can't be used here.
+template <typename T>
+details::use_type_ptr use_struct(std::vector<T> && v,
+                                 struct_fields<T> const & fields) = delete;
+
+template <typename T>
+details::use_type_ptr use_struct(std::vector<T> const & v,
+                                 struct_fields<T> const & fields)
+{
+    return details::use_type_ptr(new details::struct_use_type<T>(v, fields));
+}
+
+} // namespace soci
+
+#endif // SOCI_STRUCT_EXCHANGE_H_INCLUDED
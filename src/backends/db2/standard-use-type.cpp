@@ -125,6 +125,7 @@ void *db2_standard_use_type_backend::prepare_for_bind(
         break;
     case x_statement:
     case x_rowid:
+    case x_binary:
         break;
     }
 
@@ -14,7 +14,8 @@ using namespace soci;
 using namespace soci::details;
 
 db2_statement_backend::db2_statement_backend(db2_session_backend &session)
-    : session_(session),hasVectorUseElements(false),use_binding_method_(details::db2::BOUND_BY_NONE)
+    : session_(session),hasVectorUseElements(false),use_binding_method_(details::db2::BOUND_BY_NONE),
+      structInto(NULL),structUse(NULL),structIntoPosition(0),structUsePosition(0)
 {
 }
 
@@ -130,6 +131,11 @@ db2_statement_backend::execute(int  number )
     SQLUINTEGER rows_processed = 0;
     SQLRETURN cliRC;
 
+    if (structUse)
+    {
+        bind_struct_parameters();
+    }
+
     if (hasVectorUseElements)
     {
         SQLSetStmtAttr(hStmt, SQL_ATTR_PARAMS_PROCESSED_PTR, &rows_processed, 0);
@@ -165,7 +171,14 @@ db2_statement_backend::fetch(int  number )
 {
     numRowsFetched = 0;
 
-    SQLSetStmtAttr(hStmt, SQL_ATTR_ROW_BIND_TYPE, SQL_BIND_BY_COLUMN, 0);
+    if (structInto)
+    {
+        bind_struct_columns(number);
+    }
+    else
+    {
+        SQLSetStmtAttr(hStmt, SQL_ATTR_ROW_BIND_TYPE, SQL_BIND_BY_COLUMN, 0);
+    }
     SQLSetStmtAttr(hStmt, SQL_ATTR_ROW_ARRAY_SIZE, db2::int_as_ptr(number), 0);
     SQLSetStmtAttr(hStmt, SQL_ATTR_ROWS_FETCHED_PTR, &numRowsFetched, 0);
 
@@ -324,3 +337,173 @@ db2_vector_use_type_backend * db2_statement_backend::make_vector_use_type_backen
     hasVectorUseElements = true;
     return new db2_vector_use_type_backend(*this);
 }
+
+void db2_statement_backend::define_struct_by_pos(int& position, struct_vector_base& v)
+{
+    if (structInto != NULL)
+    {
+        throw soci_error("Only a single vector of structs can be used for the into elements.");
+    }
+
+    structInto = &v;
+    structIntoPosition = position;
+    position += static_cast<int>(v.fields().size());
+}
+
+void db2_statement_backend::bind_struct_by_pos(int& position, struct_vector_base& v)
+{
+    if (use_binding_method_ == details::db2::BOUND_BY_NAME)
+    {
+        throw soci_error("Binding for use elements must be either by position or by name.");
+    }
+
+    if (structUse != NULL)
+    {
+        throw soci_error("Only a single vector of structs can be used for the use elements.");
+    }
+
+    structUse = &v;
+    structUsePosition = position;
+    position += static_cast<int>(v.fields().size());
+
+    use_binding_method_ = details::db2::BOUND_BY_POSITION;
+    hasVectorUseElements = true;
+}
+
+void db2_statement_backend::clean_up_struct(struct_vector_base& v)
+{
+    if (structInto == &v)
+        structInto = NULL;
+    if (structUse == &v)
+        structUse = NULL;
+}
+
+namespace
+{
+
+// This is similar to the function with the same name in the ODBC backend, but
+// uses the same SQL types as the other use elements of this backend: notably,
+// DB2 doesn't have TINYINT, so 8-bit integers are bound as SMALLINT.
+void get_struct_field_types(struct_field const& field,
+    SQLSMALLINT& cType, SQLSMALLINT& sqlType)
+{
+    switch (field.type_)
+    {
+    case x_char:
+        cType = SQL_C_CHAR;
+        sqlType = SQL_VARCHAR;
+        break;
+    case x_int8:
+        cType = SQL_C_STINYINT;
+        sqlType = SQL_SMALLINT;
+        break;
+    case x_uint8:
+        cType = SQL_C_UTINYINT;
+        sqlType = SQL_SMALLINT;
+        break;
+    case x_int16:
+        cType = SQL_C_SSHORT;
+        sqlType = SQL_SMALLINT;
+        break;
+    case x_uint16:
+        cType = SQL_C_USHORT;
+        sqlType = SQL_SMALLINT;
+        break;
+    case x_int32:
+        cType = SQL_C_SLONG;
+        sqlType = SQL_INTEGER;
+        break;
+    case x_uint32:
+        cType = SQL_C_ULONG;
+        sqlType = SQL_INTEGER;
+        break;
+    case x_int64:
+        cType = SQL_C_SBIGINT;
+        sqlType = SQL_BIGINT;
+        break;
+    case x_uint64:
+        cType = SQL_C_UBIGINT;
+        sqlType = SQL_BIGINT;
+        break;
+    case x_double:
+        cType = SQL_C_DOUBLE;
+        sqlType = SQL_DOUBLE;
+        break;
+    default:
+        throw soci_error("Struct field of non-supported type.");
+    }
+
+    if (field.indOffset_ != -1 && field.indSize_ != sizeof(SQLLEN))
+    {
+        throw soci_error("Struct field indicator must be of SQLLEN type.");
+    }
+}
+
+} // anonymous namespace
+
+void db2_statement_backend::bind_struct_columns(int rows)
+{
+    // Make sure the vector has enough space for all the rows before getting
+    // the pointer to its data, as it could be reallocated when resizing it.
+    structInto->vector_resize(static_cast<std::size_t>(rows));
+    char* const data = static_cast<char*>(structInto->vector_data());
+
+    SQLSetStmtAttr(hStmt, SQL_ATTR_ROW_BIND_TYPE,
+                   db2::int_as_ptr(static_cast<int>(structInto->element_size())), 0);
+
+    std::vector<struct_field> const& fields = structInto->fields();
+    for (std::size_t i = 0; i != fields.size(); ++i)
+    {
+        struct_field const& f = fields[i];
+
+        SQLSMALLINT cType, sqlType;
+        get_struct_field_types(f, cType, sqlType);
+
+        SQLLEN* const ind = f.indOffset_ == -1
+            ? NULL
+            : reinterpret_cast<SQLLEN*>(data + f.indOffset_);
+
+        SQLRETURN cliRC = SQLBindCol(hStmt,
+            static_cast<SQLUSMALLINT>(structIntoPosition + static_cast<int>(i)),
+            cType, data + f.offset_, static_cast<SQLLEN>(f.size_), ind);
+        if (cliRC != SQL_SUCCESS)
+        {
+            throw db2_soci_error(db2_soci_error::sqlState("Error while binding struct field",SQL_HANDLE_STMT,hStmt),cliRC);
+        }
+    }
+}
+
+void db2_statement_backend::bind_struct_parameters()
+{
+    char* const data = static_cast<char*>(structUse->vector_data());
+
+    SQLSetStmtAttr(hStmt, SQL_ATTR_PARAM_BIND_TYPE,
+                   db2::int_as_ptr(static_cast<int>(structUse->element_size())), 0);
+    SQLSetStmtAttr(hStmt, SQL_ATTR_PARAMSET_SIZE,
+                   db2::int_as_ptr(static_cast<int>(structUse->vector_size())), 0);
+
+    std::vector<struct_field> const& fields = structUse->fields();
+    for (std::size_t i = 0; i != fields.size(); ++i)
+    {
+        struct_field const& f = fields[i];
+
+        SQLSMALLINT cType, sqlType;
+        get_struct_field_types(f, cType, sqlType);
+
+        // Without the indicator, the strings must be NUL-terminated.
+        SQLLEN* const ind = f.indOffset_ == -1
+            ? NULL
+            : reinterpret_cast<SQLLEN*>(data + f.indOffset_);
+
+        SQLULEN const columnSize = f.type_ == x_char ? f.size_ - 1 : f.size_;
+
+        SQLRETURN cliRC = SQLBindParameter(hStmt,
+            static_cast<SQLUSMALLINT>(structUsePosition + static_cast<int>(i)),
+            SQL_PARAM_INPUT, cType, sqlType, columnSize, 0,
+            data + f.offset_, static_cast<SQLLEN>(f.size_), ind);
+        if (cliRC != SQL_SUCCESS)
+        {
+            throw db2_soci_error(db2_soci_error::sqlState("Error while binding struct field",SQL_HANDLE_STMT,hStmt),cliRC);
+        }
+    }
+}
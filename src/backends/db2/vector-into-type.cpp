@@ -9,6 +9,7 @@
 #define SOCI_DB2_SOURCE
 #include "soci/db2/soci-db2.h"
 #include "soci-mktime.h"
+#include "soci-vector-helpers.h"
 #include <cctype>
 #include <cstdint>
 #include <cstdio>
@@ -19,6 +20,72 @@
 using namespace soci;
 using namespace soci::details;
 
+namespace
+{
+
+// Size of the first chunk used for retrieving the long column values.
+std::size_t const longDataChunkSize = 1024;
+
+// Retrieve the value of the given column of the current row into the provided
+// string or byte vector using as many SQLGetData() calls as necessary and
+// return its length or SQL_NULL_DATA.
+template <typename T>
+SQLLEN get_long_value(SQLHANDLE hStmt, SQLUSMALLINT colNum, SQLSMALLINT cType,
+                      T &value)
+{
+    // SQLGetData() always appends a trailing NUL when retrieving SQL_C_CHAR
+    // data, so the buffer must have space for it, but not for SQL_C_BINARY.
+    SQLLEN const nulLen = cType == SQL_C_CHAR ? 1 : 0;
+
+    std::size_t len = 0;
+    value.resize(longDataChunkSize);
+
+    for (;;)
+    {
+        SQLLEN const avail = static_cast<SQLLEN>(value.size() - len);
+
+        SQLLEN ind = 0;
+        SQLRETURN cliRC = SQLGetData(hStmt, colNum, cType,
+                                     &value[len], avail, &ind);
+        if (cliRC == SQL_NO_DATA)
+            break;
+
+        if (cliRC != SQL_SUCCESS && cliRC != SQL_SUCCESS_WITH_INFO)
+        {
+            throw db2_soci_error(db2_soci_error::sqlState(
+                "Error while getting long column data", SQL_HANDLE_STMT, hStmt), cliRC);
+        }
+
+        if (ind == SQL_NULL_DATA)
+        {
+            value.clear();
+            return SQL_NULL_DATA;
+        }
+
+        if (ind != SQL_NO_TOTAL && ind + nulLen <= avail)
+        {
+            // This was the last chunk.
+            len += static_cast<std::size_t>(ind);
+            break;
+        }
+
+        // The data was truncated, get the rest of it into a bigger buffer.
+        len += static_cast<std::size_t>(avail - nulLen);
+
+        std::size_t newSize = 2*value.size();
+        if (ind != SQL_NO_TOTAL)
+            newSize = len + static_cast<std::size_t>(ind - (avail - nulLen) + nulLen);
+
+        value.resize(newSize);
+    }
+
+    value.resize(len);
+
+    return static_cast<SQLLEN>(len);
+}
+
+} // anonymous namespace
+
 void db2_vector_into_type_backend::prepare_indicators(std::size_t size)
 {
     if (size == 0)
@@ -154,15 +221,31 @@ void db2_vector_into_type_backend::define_by_pos(
         }
         break;
     case x_stdstring:
+    case x_xmltype:
+    case x_longstring:
+    case x_binary:
         {
-            cType = SQL_C_CHAR;
-            std::vector<std::string> *v
-                = static_cast<std::vector<std::string> *>(data);
-            colSize = statement_.column_size(position) + 1;
-            std::size_t bufSize = colSize * v->size();
-            buf = new char[bufSize];
+            // Binary values don't need space for the trailing NUL.
+            cType = type == x_binary ? SQL_C_BINARY : SQL_C_CHAR;
+            std::size_t const vsize = get_vector_size(type, data);
+            prepare_indicators(vsize);
 
-            prepare_indicators(v->size());
+            colSize = statement_.column_size(position);
+            if (colSize >= maxColSize || colSize == 0)
+            {
+                // Don't allocate the buffer for all rows for big columns,
+                // such as BLOB or CLOB, but leave them unbound and retrieve
+                // their values directly into the vector after fetching.
+                longColumn = true;
+                position_ = position++;
+                return;
+            }
+
+            if (type != x_binary)
+                colSize++;
+
+            std::size_t bufSize = colSize * vsize;
+            buf = new char[bufSize];
 
             size = static_cast<SQLINTEGER>(colSize);
             data = buf;
@@ -189,11 +272,11 @@ void db2_vector_into_type_backend::define_by_pos(
     case x_statement:
     case x_rowid:
     case x_blob:
-    case x_xmltype:
-    case x_longstring:
         throw soci_error("Unsupported type for vector into parameter");
     }
 
+    position_ = position;
+
     SQLRETURN cliRC = SQLBindCol(statement_.hStmt, static_cast<SQLUSMALLINT>(position++),
                               cType, data, size, &indVec[0]);
     if (cliRC != SQL_SUCCESS)
@@ -213,8 +296,13 @@ void db2_vector_into_type_backend::post_fetch(bool gotData, indicator *ind)
     {
         // first, deal with data
 
-        // only std::string, std::tm and Statement need special handling
-        if (type == x_char)
+        // only strings, binary values, std::tm and Statement need special
+        // handling
+        if (longColumn)
+        {
+            get_long_data();
+        }
+        else if (type == x_char)
         {
             std::vector<char> *vp
                 = static_cast<std::vector<char> *>(data);
@@ -228,23 +316,20 @@ void db2_vector_into_type_backend::post_fetch(bool gotData, indicator *ind)
                 pos += colSize;
             }
         }
-        if (type == x_stdstring)
+        else if (type == x_stdstring || type == x_xmltype || type == x_longstring)
         {
-            std::vector<std::string> *vp
-                = static_cast<std::vector<std::string> *>(data);
-
-            std::vector<std::string> &v(*vp);
-
             const char *pos = buf;
-            std::size_t const vsize = v.size();
+            std::size_t const vsize = get_vector_size(type, data);
             for (std::size_t i = 0; i != vsize; ++i, pos += colSize)
             {
+                std::string& value = vector_string_value(type, data, i);
+
                 // See ODBC backend for explanation, this code for determining
                 // the string length is exactly the same as there.
                 SQLLEN const len = indVec[i];
                 if (len == -1)
                 {
-                    v[i].clear();
+                    value.clear();
                     continue;
                 }
 
@@ -258,7 +343,31 @@ void db2_vector_into_type_backend::post_fetch(bool gotData, indicator *ind)
                     }
                 }
 
-                v[i].assign(pos, end - pos);
+                value.assign(pos, end - pos);
+            }
+        }
+        else if (type == x_binary)
+        {
+            std::vector<std::vector<uint8_t> > *vp
+                = static_cast<std::vector<std::vector<uint8_t> > *>(data);
+
+            std::vector<std::vector<uint8_t> > &v(*vp);
+
+            const char *pos = buf;
+            std::size_t const vsize = v.size();
+            for (std::size_t i = 0; i != vsize; ++i, pos += colSize)
+            {
+                SQLLEN const len = indVec[i];
+                if (len == -1)
+                {
+                    v[i].clear();
+                    continue;
+                }
+
+                // The value may have been truncated to the buffer size.
+                std::size_t const n = static_cast<std::size_t>(len) < colSize
+                    ? static_cast<std::size_t>(len) : colSize;
+                v[i].assign(pos, pos + n);
             }
         }
         else if (type == x_stdtm)
@@ -315,6 +424,40 @@ void db2_vector_into_type_backend::post_fetch(bool gotData, indicator *ind)
     }
 }
 
+void db2_vector_into_type_backend::get_long_data()
+{
+    SQLUSMALLINT const colNum = static_cast<SQLUSMALLINT>(position_);
+
+    std::size_t const rows = statement_.get_number_of_rows();
+    for (std::size_t i = 0; i != rows; ++i)
+    {
+        // SQLGetData() retrieves the data of the current row of the rowset,
+        // so make the row we need current first.
+        if (rows > 1)
+        {
+            SQLRETURN cliRC = SQLSetPos(statement_.hStmt,
+                                        static_cast<SQLSETPOSIROW>(i + 1),
+                                        SQL_POSITION, SQL_LOCK_NO_CHANGE);
+            if (cliRC != SQL_SUCCESS && cliRC != SQL_SUCCESS_WITH_INFO)
+            {
+                throw db2_soci_error(db2_soci_error::sqlState(
+                    "Error while positioning in the rowset", SQL_HANDLE_STMT, statement_.hStmt), cliRC);
+            }
+        }
+
+        if (type == x_binary)
+        {
+            indVec[i] = get_long_value(statement_.hStmt, colNum, cType,
+                exchange_vector_type_cast<x_binary>(data)[i]);
+        }
+        else
+        {
+            indVec[i] = get_long_value(statement_.hStmt, colNum, cType,
+                vector_string_value(type, data, i));
+        }
+    }
+}
+
 void db2_vector_into_type_backend::resize(std::size_t sz)
 {
     indVec.resize(sz);
@@ -398,12 +541,31 @@ void db2_vector_into_type_backend::resize(std::size_t sz)
             v->resize(sz);
         }
         break;
+    case x_binary:
+        {
+            std::vector<std::vector<uint8_t> > *v
+                = static_cast<std::vector<std::vector<uint8_t> > *>(data);
+            v->resize(sz);
+        }
+        break;
+    case x_xmltype:
+        {
+            std::vector<xml_type> *v
+                = static_cast<std::vector<xml_type> *>(data);
+            v->resize(sz);
+        }
+        break;
+    case x_longstring:
+        {
+            std::vector<long_string> *v
+                = static_cast<std::vector<long_string> *>(data);
+            v->resize(sz);
+        }
+        break;
 
     case x_statement: break; // not supported
     case x_rowid:     break; // not supported
     case x_blob:      break; // not supported
-    case x_xmltype:   break; // not supported
-    case x_longstring:break; // not supported
     }
 }
 
@@ -490,12 +652,31 @@ std::size_t db2_vector_into_type_backend::size()
             sz = v->size();
         }
         break;
+    case x_binary:
+        {
+            std::vector<std::vector<uint8_t> > *v
+                = static_cast<std::vector<std::vector<uint8_t> > *>(data);
+            sz = v->size();
+        }
+        break;
+    case x_xmltype:
+        {
+            std::vector<xml_type> *v
+                = static_cast<std::vector<xml_type> *>(data);
+            sz = v->size();
+        }
+        break;
+    case x_longstring:
+        {
+            std::vector<long_string> *v
+                = static_cast<std::vector<long_string> *>(data);
+            sz = v->size();
+        }
+        break;
 
     case x_statement: break; // not supported
     case x_rowid:     break; // not supported
     case x_blob:      break; // not supported
-    case x_xmltype:   break; // not supported
-    case x_longstring:break; // not supported
     }
 
     return sz;
@@ -9,6 +9,7 @@
 #define SOCI_DB2_SOURCE
 #include "soci/soci-platform.h"
 #include "soci/db2/soci-db2.h"
+#include "soci-vector-helpers.h"
 #include <cctype>
 #include <cstdint>
 #include <cstdio>
@@ -171,20 +172,19 @@ void *db2_vector_use_type_backend::prepare_for_bind(SQLUINTEGER &size,
         }
         break;
     case x_stdstring:
+    case x_xmltype:
+    case x_longstring:
         {
-            sqlType = SQL_CHAR;
+            // Long strings are used with CLOB and XML columns.
+            sqlType = type == x_stdstring ? SQL_CHAR : SQL_LONGVARCHAR;
             cType = SQL_C_CHAR;
 
-            std::vector<std::string> *vp
-                = static_cast<std::vector<std::string> *>(data);
-            std::vector<std::string> &v(*vp);
-
             std::size_t maxSize = 0;
-            std::size_t const vecSize = v.size();
+            std::size_t const vecSize = get_vector_size(type, data);
             prepare_indicators(vecSize);
             for (std::size_t i = 0; i != vecSize; ++i)
             {
-                std::size_t sz = v[i].length();
+                std::size_t sz = vector_string_value(type, data, i).length();
                 indVec[i] = static_cast<long>(sz);
                 maxSize = sz > maxSize ? sz : maxSize;
             }
@@ -197,7 +197,45 @@ void *db2_vector_use_type_backend::prepare_for_bind(SQLUINTEGER &size,
             char *pos = buf;
             for (std::size_t i = 0; i != vecSize; ++i)
             {
-                memcpy(pos, v[i].c_str(), v[i].length());
+                std::string const& value = vector_string_value(type, data, i);
+                memcpy(pos, value.c_str(), value.length());
+                pos += maxSize;
+            }
+
+            sqlData = buf;
+            size = static_cast<SQLINTEGER>(maxSize);
+        }
+        break;
+    case x_binary:
+        {
+            sqlType = SQL_VARBINARY;
+            cType = SQL_C_BINARY;
+
+            std::vector<std::vector<uint8_t> > *vp
+                = static_cast<std::vector<std::vector<uint8_t> > *>(data);
+            std::vector<std::vector<uint8_t> > &v(*vp);
+
+            std::size_t maxSize = 0;
+            std::size_t const vecSize = v.size();
+            prepare_indicators(vecSize);
+            for (std::size_t i = 0; i != vecSize; ++i)
+            {
+                std::size_t sz = v[i].size();
+                indVec[i] = static_cast<long>(sz);
+                maxSize = sz > maxSize ? sz : maxSize;
+            }
+
+            // The buffer can't be empty even if all values are.
+            if (maxSize == 0)
+                maxSize = 1;
+
+            buf = new char[maxSize * vecSize];
+
+            char *pos = buf;
+            for (std::size_t i = 0; i != vecSize; ++i)
+            {
+                if (!v[i].empty())
+                    memcpy(pos, &v[i][0], v[i].size());
                 pos += maxSize;
             }
 
@@ -226,8 +264,6 @@ void *db2_vector_use_type_backend::prepare_for_bind(SQLUINTEGER &size,
     case x_statement: break; // not supported
     case x_rowid:     break; // not supported
     case x_blob:      break; // not supported
-    case x_xmltype:   break; // not supported
-    case x_longstring:break; // not supported
     }
 
     colSize = size;
@@ -330,8 +366,9 @@ void db2_vector_use_type_backend::pre_use(indicator const *ind)
             }
             else
             {
-            // for strings we have already set the values
-            if (type != x_stdstring)
+            // for strings and binary values we have already set the values
+            if (type != x_stdstring && type != x_xmltype &&
+                    type != x_longstring && type != x_binary)
                 {
                     indVec[i] = SQL_NTS;  // value is OK
                 }
@@ -344,8 +381,9 @@ void db2_vector_use_type_backend::pre_use(indicator const *ind)
         std::size_t const vsize = this->size();
         for (std::size_t i = 0; i != vsize; ++i)
         {
-            // for strings we have already set the values
-            if (type != x_stdstring)
+            // for strings and binary values we have already set the values
+            if (type != x_stdstring && type != x_xmltype &&
+                    type != x_longstring && type != x_binary)
             {
                 indVec[i] = SQL_NTS;  // value is OK
             }
@@ -448,12 +486,31 @@ std::size_t db2_vector_use_type_backend::size()
             sz = vp->size();
         }
         break;
+    case x_binary:
+        {
+            std::vector<std::vector<uint8_t> > *vp
+                = static_cast<std::vector<std::vector<uint8_t> > *>(data);
+            sz = vp->size();
+        }
+        break;
+    case x_xmltype:
+        {
+            std::vector<xml_type> *vp
+                = static_cast<std::vector<xml_type> *>(data);
+            sz = vp->size();
+        }
+        break;
+    case x_longstring:
+        {
+            std::vector<long_string> *vp
+                = static_cast<std::vector<long_string> *>(data);
+            sz = vp->size();
+        }
+        break;
 
     case x_statement: break; // not supported
     case x_rowid:     break; // not supported
     case x_blob:      break; // not supported
-    case x_xmltype:   break; // not supported
-    case x_longstring:break; // not supported
     }
 
     return sz;
@@ -221,7 +221,11 @@ std::string getTextParam(XSQLVAR const *var)
     return std::string(var->sqldata + offset, size);
 }
 
-void copy_from_blob(firebird_statement_backend &st, char *buf, std::string &out)
+namespace
+{
+
+template <typename T>
+void do_copy_from_blob(firebird_statement_backend &st, char *buf, T &out)
 {
     firebird_blob_backend blob(st.session_);
 
@@ -233,17 +237,32 @@ void copy_from_blob(firebird_statement_backend &st, char *buf, std::string &out)
 
     std::size_t const len_total = blob.get_len();
     out.resize(len_total);
+    if (len_total == 0)
+        return;
 
     std::size_t const len_read = blob.read_from_start(&out[0], len_total);
     if (len_read != len_total)
     {
         std::ostringstream os;
         os << "Read " << len_read << " bytes instead of expected "
-           << len_total << " from Firebird text blob object";
+           << len_total << " from Firebird blob object";
         throw soci_error(os.str());
     }
 }
 
+} // anonymous namespace
+
+void copy_from_blob(firebird_statement_backend &st, char *buf, std::string &out)
+{
+    do_copy_from_blob(st, buf, out);
+}
+
+void copy_from_blob(firebird_statement_backend &st, char *buf,
+    std::vector<uint8_t> &out)
+{
+    do_copy_from_blob(st, buf, out);
+}
+
 } // namespace firebird
 
 } // namespace details
@@ -8,10 +8,18 @@
 #define SOCI_FIREBIRD_SOURCE
 #include "soci/firebird/soci-firebird.h"
 #include "firebird/error-firebird.h"
+#include <algorithm>
 #include <cctype>
+#include <cstring>
 #include <sstream>
 #include <iostream>
 
+// Batches are only available in Firebird 4 and later.
+#if defined(FB_API_VER) && FB_API_VER >= 40
+    #define SOCI_FIREBIRD_HAS_BATCH
+    #include <firebird/Interface.h>
+#endif
+
 using namespace soci;
 using namespace soci::details;
 using namespace soci::details::firebird;
@@ -19,7 +27,7 @@ using namespace soci::details::firebird;
 firebird_statement_backend::firebird_statement_backend(firebird_session_backend &session)
     : session_(session), stmtp_(0), sqldap_(NULL), sqlda2p_(NULL),
         boundByName_(false), boundByPos_(false), rowsFetched_(0), endOfRowSet_(false), rowsAffectedBulk_(-1LL),
-            intoType_(eStandard), useType_(eStandard), procedure_(false)
+            intoType_(eStandard), useType_(eStandard), procedure_(false), useBatch_(true)
 {}
 
 void firebird_statement_backend::prepareSQLDA(XSQLDA ** sqldap, short size)
@@ -352,6 +360,8 @@ void firebird_statement_backend::prepare(std::string const & query,
     // reset types of use buffers
     useType_ = eStandard;
     uses_.resize(0);
+
+    useBatch_ = true;
 }
 
 
@@ -409,35 +419,40 @@ firebird_statement_backend::execute(int number)
 
     if (useType_ == eVector)
     {
-        long long rowsAffectedBulkTemp = 0;
-
-        // Here we have to explicitly loop to achieve the
-        // effect of inserting or updating with vector use elements.
         std::size_t rows = static_cast<firebird_vector_use_type_backend*>(uses_[0])->size();
-        for (std::size_t row=0; row < rows; ++row)
+
+        // Send all rows at once if possible, this also sets rowsAffectedBulk_.
+        if (!executeBatch(rows))
         {
-            // first we have to prepare input parameters
-            for (std::size_t col=0; col<usize; ++col)
-            {
-                static_cast<firebird_vector_use_type_backend*>(uses_[col])->exchangeData(row);
-            }
+            long long rowsAffectedBulkTemp = 0;
 
-            // then execute query
-            if (isc_dsql_execute(stat, session_.current_transaction(), &stmtp_, SQL_DIALECT_V6, t))
+            // Here we have to explicitly loop to achieve the
+            // effect of inserting or updating with vector use elements.
+            for (std::size_t row=0; row < rows; ++row)
             {
-                // preserve the number of rows affected so far.
-                rowsAffectedBulk_ = rowsAffectedBulkTemp;
-                throw_iscerror(stat);
-            }
-            else
-            {
-                rowsAffectedBulkTemp += get_affected_rows();
+                // first we have to prepare input parameters
+                for (std::size_t col=0; col<usize; ++col)
+                {
+                    static_cast<firebird_vector_use_type_backend*>(uses_[col])->exchangeData(row);
+                }
+
+                // then execute query
+                if (isc_dsql_execute(stat, session_.current_transaction(), &stmtp_, SQL_DIALECT_V6, t))
+                {
+                    // preserve the number of rows affected so far.
+                    rowsAffectedBulk_ = rowsAffectedBulkTemp;
+                    throw_iscerror(stat);
+                }
+                else
+                {
+                    rowsAffectedBulkTemp += get_affected_rows();
+                }
+                // soci does not allow bulk insert/update and bulk select operations
+                // in same query. So here, we know that into elements are not
+                // vectors. So, there is no need to fetch data here.
             }
-            // soci does not allow bulk insert/update and bulk select operations
-            // in same query. So here, we know that into elements are not
-            // vectors. So, there is no need to fetch data here.
+            rowsAffectedBulk_ = rowsAffectedBulkTemp;
         }
-        rowsAffectedBulk_ = rowsAffectedBulkTemp;
     }
     else
     {
@@ -473,6 +488,274 @@ firebird_statement_backend::execute(int number)
     }
 }
 
+#ifdef SOCI_FIREBIRD_HAS_BATCH
+
+namespace
+{
+    // Maximal size of the messages sent to the server in one batch, this
+    // must be less than the batch buffer size, which is 16MiB by default.
+    std::size_t const batchMaxBytes = 8*1024*1024;
+
+    // Helpers releasing the Firebird interfaces in their dtor.
+    template <typename T>
+    void releaseInterface(T * p) { p->release(); }
+    void releaseInterface(Firebird::IXpbBuilder * p) { p->dispose(); }
+    void releaseInterface(Firebird::IBatchCompletionState * p) { p->dispose(); }
+
+    template <typename T>
+    class InterfacePtr
+    {
+    public:
+        explicit InterfacePtr(T * p = NULL) : p_(p) {}
+        ~InterfacePtr() { if (p_ != NULL) releaseInterface(p_); }
+
+        T * get() const { return p_; }
+        T * operator->() const { return p_; }
+
+        // Used with the functions returning the interface via void pointer.
+        T ** address() { return &p_; }
+
+    private:
+        T * p_;
+
+        SOCI_NOT_COPYABLE(InterfacePtr)
+    };
+
+    class Status
+    {
+    public:
+        Status()
+            : status_(fb_get_master_interface()->getStatus()),
+              wrapper_(status_)
+        {}
+
+        ~Status() { status_->dispose(); }
+
+        Firebird::IStatus * raw() { return status_; }
+        Firebird::CheckStatusWrapper * get() { return &wrapper_; }
+
+        bool failed() const
+        {
+            return (status_->getState() & Firebird::IStatus::STATE_ERRORS) != 0;
+        }
+
+        void throwError() const
+        {
+            // Convert the status to the usual status vector, taking into
+            // account that counted strings take 3 elements instead of 2.
+            std::vector<ISC_STATUS> stat;
+            for (intptr_t const * p = status_->getErrors(); *p != isc_arg_end; )
+            {
+                std::size_t const len = *p == isc_arg_cstring ? 3 : 2;
+                stat.insert(stat.end(), p, p + len);
+                p += len;
+            }
+            stat.push_back(isc_arg_end);
+
+            throw_iscerror(&stat[0]);
+        }
+
+    private:
+        Firebird::IStatus * const status_;
+        Firebird::CheckStatusWrapper wrapper_;
+
+        SOCI_NOT_COPYABLE(Status)
+    };
+
+    // Add the given number of messages to the batch and execute it, adding
+    // the number of affected rows to rowsAffected and throwing if any of the
+    // messages failed.
+    void runBatch(Firebird::IBatch * batch, Firebird::ITransaction * tr,
+        void const * data, std::size_t count, long long & rowsAffected)
+    {
+        Status status;
+
+        batch->add(status.get(), static_cast<unsigned>(count), data);
+        if (status.failed())
+        {
+            status.throwError();
+        }
+
+        InterfacePtr<Firebird::IBatchCompletionState>
+            cs(batch->execute(status.get(), tr));
+        if (status.failed())
+        {
+            status.throwError();
+        }
+
+        unsigned const size = cs->getSize(status.get());
+        for (unsigned i = 0; i < size; ++i)
+        {
+            int const state = cs->getState(status.get(), i);
+            if (state == Firebird::IBatchCompletionState::EXECUTE_FAILED)
+            {
+                Status error;
+                cs->getStatus(status.get(), error.raw(), i);
+                error.throwError();
+            }
+
+            if (state > 0)
+            {
+                rowsAffected += state;
+            }
+        }
+    }
+}
+
+#endif // SOCI_FIREBIRD_HAS_BATCH
+
+bool firebird_statement_backend::executeBatch(std::size_t rows)
+{
+#ifdef SOCI_FIREBIRD_HAS_BATCH
+    using namespace Firebird;
+
+    if (!useBatch_)
+        return false;
+
+    // Using BLOBs with batches requires registering them with the batch, so
+    // don't bother with it and use the usual loop for such statements.
+    for (short i = 0; i < sqlda2p_->sqld; ++i)
+    {
+        if ((sqlda2p_->sqlvar[i].sqltype & ~1) == SQL_BLOB)
+        {
+            useBatch_ = false;
+            return false;
+        }
+    }
+
+    ISC_STATUS stat[stat_size];
+    InterfacePtr<IStatement> stmt;
+    InterfacePtr<ITransaction> tr;
+    if (fb_get_statement_interface(stat, stmt.address(), &stmtp_) ||
+        fb_get_transaction_interface(stat, tr.address(),
+                                     session_.current_transaction()))
+    {
+        useBatch_ = false;
+        return false;
+    }
+
+    Status status;
+    InterfacePtr<IMessageMetadata> meta(stmt->getInputMetadata(status.get()));
+    if (status.failed())
+    {
+        useBatch_ = false;
+        return false;
+    }
+
+    // We fill the messages from the XSQLDA buffers, so check that they use
+    // the same types and sizes, as they should.
+    std::vector<unsigned> offsets(sqlda2p_->sqld);
+    std::vector<unsigned> nullOffsets(sqlda2p_->sqld);
+    for (short i = 0; i < sqlda2p_->sqld; ++i)
+    {
+        XSQLVAR const & var = sqlda2p_->sqlvar[i];
+        unsigned const n = static_cast<unsigned>(i);
+
+        if ((meta->getType(status.get(), n) & ~1u) != static_cast<unsigned>(var.sqltype & ~1) ||
+            meta->getLength(status.get(), n) != static_cast<unsigned>(var.sqllen))
+        {
+            useBatch_ = false;
+            return false;
+        }
+
+        offsets[i] = meta->getOffset(status.get(), n);
+        nullOffsets[i] = meta->getNullOffset(status.get(), n);
+    }
+
+    std::size_t const msgLen = meta->getAlignedLength(status.get());
+    if (status.failed())
+    {
+        useBatch_ = false;
+        return false;
+    }
+
+    // Ask for the number of rows affected by each message.
+    InterfacePtr<IXpbBuilder> params(fb_get_master_interface()->getUtilInterface()->
+        getXpbBuilder(status.get(), IXpbBuilder::BATCH, NULL, 0));
+    params->insertInt(status.get(), IBatch::TAG_RECORD_COUNTS, 1);
+
+    // This fails if the server doesn't support batches.
+    InterfacePtr<IBatch> batch(stmt->createBatch(status.get(), meta.get(),
+        params->getBufferLength(status.get()), params->getBuffer(status.get())));
+    if (status.failed())
+    {
+        useBatch_ = false;
+        return false;
+    }
+
+    std::size_t const usize = uses_.size();
+    std::size_t const chunkRows = std::max<std::size_t>(1, batchMaxBytes / msgLen);
+
+    // Use ISC_INT64 elements to ensure that the messages are aligned.
+    std::vector<ISC_INT64> buffer;
+
+    long long rowsAffected = 0;
+    try
+    {
+        for (std::size_t first = 0; first < rows; first += chunkRows)
+        {
+            std::size_t const count = std::min(chunkRows, rows - first);
+            buffer.assign((count*msgLen + sizeof(ISC_INT64) - 1)/sizeof(ISC_INT64), 0);
+            char * const data = reinterpret_cast<char *>(&buffer[0]);
+
+            std::size_t added = 0;
+            try
+            {
+                for (; added < count; ++added)
+                {
+                    for (std::size_t col = 0; col < usize; ++col)
+                    {
+                        static_cast<firebird_vector_use_type_backend*>(
+                            uses_[col])->exchangeData(first + added);
+                    }
+
+                    char * const msg = data + added*msgLen;
+                    for (short i = 0; i < sqlda2p_->sqld; ++i)
+                    {
+                        XSQLVAR const & var = sqlda2p_->sqlvar[i];
+
+                        std::size_t len = static_cast<std::size_t>(var.sqllen);
+                        if ((var.sqltype & ~1) == SQL_VARYING)
+                            len += sizeof(short);
+                        std::memcpy(msg + offsets[i], var.sqldata, len);
+
+                        short const ind = (var.sqltype & 1) ? *var.sqlind : 0;
+                        std::memcpy(msg + nullOffsets[i], &ind, sizeof(ind));
+                    }
+                }
+            }
+            catch (...)
+            {
+                // Still execute the rows before the one which couldn't be
+                // converted, as executing them one by one would do.
+                if (added != 0)
+                {
+                    runBatch(batch.get(), tr.get(), data, added, rowsAffected);
+                }
+
+                throw;
+            }
+
+            runBatch(batch.get(), tr.get(), data, count, rowsAffected);
+        }
+    }
+    catch (...)
+    {
+        // preserve the number of rows affected so far.
+        rowsAffectedBulk_ = rowsAffected;
+        throw;
+    }
+
+    rowsAffectedBulk_ = rowsAffected;
+
+    return true;
+#else // !SOCI_FIREBIRD_HAS_BATCH
+    (void)rows;
+
+    return false;
+#endif // SOCI_FIREBIRD_HAS_BATCH/!SOCI_FIREBIRD_HAS_BATCH
+}
+
 statement_backend::exec_fetch_result
 firebird_statement_backend::fetch(int number)
 {
@@ -549,8 +832,9 @@ void firebird_statement_backend::exchangeData(bool gotData, int row)
             {
                 if (intoType_ == eVector)
                 {
-                    static_cast<firebird_vector_into_type_backend*>(
-                        intos_[i])->exchangeData(row);
+                    firebird_vector_into_type_backend * const into =
+                        static_cast<firebird_vector_into_type_backend*>(intos_[i]);
+                    into->converter_(*into, row);
                 }
                 else
                 {
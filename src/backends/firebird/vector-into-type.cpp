@@ -31,6 +31,8 @@ void firebird_vector_into_type_backend::define_by_pos(
     buf_ = allocBuffer(var);
     var->sqldata = buf_;
     var->sqlind = &indISCHolder_;
+
+    converter_ = selectConverter(type_, var);
 }
 
 void firebird_vector_into_type_backend::pre_fetch()
@@ -50,8 +52,114 @@ void setIntoVector(void *p, std::size_t indx, T const &val)
     v[indx] = val;
 }
 
+// Converters used for the most common combinations of exchange and column
+// types, doing the same thing as exchangeData() but without any checks.
+template <typename T, typename S>
+void convertNumber(firebird_vector_into_type_backend &into, std::size_t row)
+{
+    S value;
+    std::memcpy(&value, into.buf_, sizeof(S));
+    (*static_cast<std::vector<T> *>(into.data_))[row] = static_cast<T>(value);
+}
+
+void convertTimestamp(firebird_vector_into_type_backend &into, std::size_t row)
+{
+    std::tm &dst = (*static_cast<std::vector<std::tm> *>(into.data_))[row];
+    dst = std::tm();
+    isc_decode_timestamp(static_cast<ISC_TIMESTAMP*>(static_cast<void*>(into.buf_)), &dst);
+}
+
+void convertDate(firebird_vector_into_type_backend &into, std::size_t row)
+{
+    std::tm &dst = (*static_cast<std::vector<std::tm> *>(into.data_))[row];
+    dst = std::tm();
+    isc_decode_sql_date(static_cast<ISC_DATE*>(static_cast<void*>(into.buf_)), &dst);
+}
+
+void convertTime(firebird_vector_into_type_backend &into, std::size_t row)
+{
+    std::tm &dst = (*static_cast<std::vector<std::tm> *>(into.data_))[row];
+    dst = std::tm();
+    isc_decode_sql_time(static_cast<ISC_TIME*>(static_cast<void*>(into.buf_)), &dst);
+}
+
+// Used for all the other cases.
+void convertGeneric(firebird_vector_into_type_backend &into, std::size_t row)
+{
+    into.exchangeData(row);
+}
+
+template <typename T>
+firebird_vector_into_type_backend::converter_type
+selectNumberConverter(XSQLVAR const *var)
+{
+    // Scaled values must be adjusted and can't be converted to integers.
+    if (var->sqlscale != 0)
+        return &convertGeneric;
+
+    switch (var->sqltype & ~1)
+    {
+    case SQL_SHORT:
+        return &convertNumber<T, int16_t>;
+    case SQL_LONG:
+        return &convertNumber<T, int32_t>;
+    case SQL_INT64:
+        return &convertNumber<T, int64_t>;
+    case SQL_FLOAT:
+        return &convertNumber<T, float>;
+    case SQL_DOUBLE:
+        return &convertNumber<T, double>;
+    default:
+        return &convertGeneric;
+    }
+}
+
 } // namespace anonymous
 
+firebird_vector_into_type_backend::converter_type
+firebird_vector_into_type_backend::selectConverter(
+    exchange_type type, XSQLVAR const *var)
+{
+    switch (type)
+    {
+    case x_int8:
+        return selectNumberConverter<int8_t>(var);
+    case x_uint8:
+        return selectNumberConverter<uint8_t>(var);
+    case x_int16:
+        return selectNumberConverter<int16_t>(var);
+    case x_uint16:
+        return selectNumberConverter<uint16_t>(var);
+    case x_int32:
+        return selectNumberConverter<int32_t>(var);
+    case x_uint32:
+        return selectNumberConverter<uint32_t>(var);
+    case x_int64:
+        return selectNumberConverter<int64_t>(var);
+    case x_uint64:
+        return selectNumberConverter<uint64_t>(var);
+    case x_double:
+        return selectNumberConverter<double>(var);
+
+    case x_stdtm:
+        switch (var->sqltype & ~1)
+        {
+        case SQL_TIMESTAMP:
+            return &convertTimestamp;
+        case SQL_TYPE_DATE:
+            return &convertDate;
+        case SQL_TYPE_TIME:
+            return &convertTime;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    return &convertGeneric;
+}
+
 // this will exchange data with vector user buffers
 void firebird_vector_into_type_backend::exchangeData(std::size_t row)
 {
@@ -144,6 +252,21 @@ void firebird_vector_into_type_backend::exchangeData(std::size_t row)
         }
         break;
 
+    case x_binary:
+        {
+            std::vector<uint8_t> &tmp = exchange_vector_type_cast<x_binary>(data_)[row];
+            if ((var->sqltype & ~1) == SQL_BLOB)
+            {
+                copy_from_blob(statement_, buf_, tmp);
+            }
+            else
+            {
+                std::string const bytes = getTextParam(var);
+                tmp.assign(bytes.begin(), bytes.end());
+            }
+        }
+        break;
+
     default:
         throw soci_error("Into vector element used with non-supported type.");
     } // switch
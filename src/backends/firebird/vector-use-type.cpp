@@ -179,7 +179,38 @@ void firebird_vector_use_type_backend::exchangeData(std::size_t row)
         // types which internally use blobs
     case x_xmltype:
     case x_longstring:
-        copy_to_blob(vector_string_value(type_, data_, row));
+        {
+            std::string const &tmp = vector_string_value(type_, data_, row);
+            copy_to_blob(tmp.c_str(), tmp.length());
+        }
+        break;
+    case x_binary:
+        {
+            std::vector<uint8_t> const &tmp
+                = *getUseVectorValue<std::vector<uint8_t> >(data_, row);
+            char const *bytes = tmp.empty()
+                ? "" : reinterpret_cast<char const *>(&tmp[0]);
+
+            // Binary values can be stored in either BLOB SUB_TYPE BINARY or
+            // [VAR]CHAR(N) CHARACTER SET OCTETS columns.
+            if ((var->sqltype & ~1) == SQL_BLOB)
+            {
+                copy_to_blob(bytes, tmp.size());
+            }
+            else
+            {
+                if (tmp.size() > static_cast<std::size_t>(var->sqllen))
+                {
+                    std::ostringstream msg;
+                    msg << "Binary value is too long (" << tmp.size()
+                        << " bytes) to be stored in column of size "
+                        << var->sqllen << " bytes";
+                    throw soci_error(msg.str());
+                }
+
+                setTextParam(bytes, tmp.size(), buf_, var);
+            }
+        }
         break;
         //  Not supported
         //  case x_cstring:
@@ -189,12 +220,13 @@ void firebird_vector_use_type_backend::exchangeData(std::size_t row)
     } // switch
 }
 
-void firebird_vector_use_type_backend::copy_to_blob(const std::string &in)
+void firebird_vector_use_type_backend::copy_to_blob(char const *data,
+                                                    std::size_t len)
 {
     delete blob_;
 
     blob_ = new firebird_blob_backend(statement_.session_);
-    blob_->append(in.c_str(), in.length());
+    blob_->append(data, len);
     ISC_QUAD blob_id = blob_->save_to_db();
     memcpy(buf_, &blob_id, sizeof(blob_id));
 }
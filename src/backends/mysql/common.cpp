@@ -7,10 +7,20 @@
 
 #define SOCI_MYSQL_SOURCE
 #include "common.h"
+#include "soci-dtocstr.h"
+#include "soci-mktime.h"
+#include "soci/blob.h"
 #include <ciso646>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
+#include <limits>
+#include <string>
+
+using namespace soci;
+using namespace soci::details;
+using namespace soci::details::mysql;
 
 char * soci::details::mysql::quote(MYSQL * conn, const char *s, size_t len)
 {
@@ -22,3 +32,390 @@ char * soci::details::mysql::quote(MYSQL * conn, const char *s, size_t len)
 
     return retv;
 }
+
+void mysql_bind_value::bind(MYSQL_BIND &b)
+{
+    std::memset(&b, 0, sizeof(b));
+
+    b.buffer_type = type_;
+    b.is_unsigned = unsigned_;
+    b.is_null = &isNull_;
+    b.error = &error_;
+    b.length = &length_;
+
+    switch (type_)
+    {
+    case MYSQL_TYPE_NULL:
+        break;
+    case MYSQL_TYPE_LONGLONG:
+        b.buffer = &integer_;
+        break;
+    case MYSQL_TYPE_DOUBLE:
+        b.buffer = &double_;
+        break;
+    case MYSQL_TYPE_DATETIME:
+        b.buffer = &time_;
+        break;
+    default:
+        b.buffer = buffer_.empty() ? NULL : &buffer_[0];
+        b.buffer_length = static_cast<unsigned long>(buffer_.size());
+        break;
+    }
+}
+
+void * soci::details::mysql::get_vector_element(
+    void *p, exchange_type type, std::size_t index)
+{
+    switch (type)
+    {
+    case x_char:
+        return &(*static_cast<std::vector<char> *>(p))[index];
+    case x_stdstring:
+        return &(*static_cast<std::vector<std::string> *>(p))[index];
+    case x_int8:
+        return &(*static_cast<std::vector<int8_t> *>(p))[index];
+    case x_uint8:
+        return &(*static_cast<std::vector<uint8_t> *>(p))[index];
+    case x_int16:
+        return &(*static_cast<std::vector<int16_t> *>(p))[index];
+    case x_uint16:
+        return &(*static_cast<std::vector<uint16_t> *>(p))[index];
+    case x_int32:
+        return &(*static_cast<std::vector<int32_t> *>(p))[index];
+    case x_uint32:
+        return &(*static_cast<std::vector<uint32_t> *>(p))[index];
+    case x_int64:
+        return &(*static_cast<std::vector<int64_t> *>(p))[index];
+    case x_uint64:
+        return &(*static_cast<std::vector<uint64_t> *>(p))[index];
+    case x_double:
+        return &(*static_cast<std::vector<double> *>(p))[index];
+    case x_stdtm:
+        return &(*static_cast<std::vector<std::tm> *>(p))[index];
+    case x_binary:
+        return &(*static_cast<std::vector<std::vector<uint8_t> > *>(p))[index];
+    default:
+        throw soci_error("Vector element used with non-supported type.");
+    }
+}
+
+namespace // anonymous
+{
+
+void set_string_value(mysql_bind_value &value, char const *s, std::size_t len)
+{
+    value.type_ = MYSQL_TYPE_STRING;
+    value.buffer_.assign(s, s + len);
+    value.length_ = static_cast<unsigned long>(len);
+}
+
+void set_integer_value(mysql_bind_value &value, long long n)
+{
+    value.type_ = MYSQL_TYPE_LONGLONG;
+    value.unsigned_ = false;
+    value.integer_ = n;
+}
+
+void set_unsigned_value(mysql_bind_value &value, unsigned long long n)
+{
+    value.type_ = MYSQL_TYPE_LONGLONG;
+    value.unsigned_ = true;
+    value.integer_ = static_cast<long long>(n);
+}
+
+// Return the value of a string column as NUL-terminated string.
+std::string get_text(mysql_bind_value const &value)
+{
+    if (value.type_ != MYSQL_TYPE_STRING && value.type_ != MYSQL_TYPE_BLOB)
+    {
+        throw soci_error("Cannot convert data.");
+    }
+
+    return value.buffer_.empty()
+        ? std::string()
+        : std::string(&value.buffer_[0], value.length_);
+}
+
+template <typename T>
+void get_integer(mysql_bind_value const &value, T &x)
+{
+    bool isUnsigned = value.unsigned_;
+    long long n = value.integer_;
+    if (value.type_ != MYSQL_TYPE_LONGLONG)
+    {
+        // This can be used for DECIMAL columns which are transferred as
+        // strings, parse them in the same way as when not using prepared
+        // statements.
+        std::string const text = get_text(value);
+        if (std::numeric_limits<T>::is_signed)
+        {
+            isUnsigned = false;
+            parse_num(text.c_str(), n);
+        }
+        else
+        {
+            unsigned long long u = 0;
+            parse_num(text.c_str(), u);
+            isUnsigned = true;
+            n = static_cast<long long>(u);
+        }
+    }
+
+    unsigned long long const max
+        = static_cast<unsigned long long>((std::numeric_limits<T>::max)());
+    if (isUnsigned)
+    {
+        if (static_cast<unsigned long long>(n) > max)
+        {
+            throw soci_error("Cannot convert data.");
+        }
+    }
+    else
+    {
+        if (n < static_cast<long long>((std::numeric_limits<T>::min)()) ||
+            (n > 0 && static_cast<unsigned long long>(n) > max))
+        {
+            throw soci_error("Cannot convert data.");
+        }
+    }
+
+    x = static_cast<T>(n);
+}
+
+} // namespace anonymous
+
+void soci::details::mysql::set_bind_value(mysql_bind_value &value,
+    exchange_type type, void const *data)
+{
+    value.unsigned_ = false;
+    value.isNull_ = 0;
+
+    switch (type)
+    {
+    case x_char:
+        set_string_value(value, static_cast<char const *>(data), 1);
+        break;
+    case x_stdstring:
+        {
+            std::string const &s = *static_cast<std::string const *>(data);
+            set_string_value(value, s.c_str(), s.size());
+        }
+        break;
+    case x_int8:
+        set_integer_value(value, *static_cast<int8_t const *>(data));
+        break;
+    case x_uint8:
+        set_unsigned_value(value, *static_cast<uint8_t const *>(data));
+        break;
+    case x_int16:
+        set_integer_value(value, *static_cast<int16_t const *>(data));
+        break;
+    case x_uint16:
+        set_unsigned_value(value, *static_cast<uint16_t const *>(data));
+        break;
+    case x_int32:
+        set_integer_value(value, *static_cast<int32_t const *>(data));
+        break;
+    case x_uint32:
+        set_unsigned_value(value, *static_cast<uint32_t const *>(data));
+        break;
+    case x_int64:
+        set_integer_value(value, *static_cast<int64_t const *>(data));
+        break;
+    case x_uint64:
+        set_unsigned_value(value, *static_cast<uint64_t const *>(data));
+        break;
+    case x_double:
+        {
+            double const d = *static_cast<double const *>(data);
+            if (is_infinity_or_nan(d)) {
+                throw soci_error(
+                    "Use element used with infinity or NaN, which are "
+                    "not supported by the MySQL server.");
+            }
+
+            value.type_ = MYSQL_TYPE_DOUBLE;
+            value.double_ = d;
+        }
+        break;
+    case x_stdtm:
+        {
+            std::tm const &t = *static_cast<std::tm const *>(data);
+
+            value.type_ = MYSQL_TYPE_DATETIME;
+            value.time_ = MYSQL_TIME();
+            value.time_.year = t.tm_year + 1900;
+            value.time_.month = t.tm_mon + 1;
+            value.time_.day = t.tm_mday;
+            value.time_.hour = t.tm_hour;
+            value.time_.minute = t.tm_min;
+            value.time_.second = t.tm_sec;
+            value.time_.time_type = MYSQL_TIMESTAMP_DATETIME;
+        }
+        break;
+    case x_blob:
+        {
+            // blob::get_backend() is not const but we don't modify it.
+            blob &b = *static_cast<blob *>(const_cast<void *>(data));
+            mysql_blob_backend *bbe =
+                static_cast<mysql_blob_backend *>(b.get_backend());
+
+            std::size_t const len = bbe->get_len();
+            char const *buf = reinterpret_cast<char const *>(bbe->get_buffer());
+            value.type_ = MYSQL_TYPE_BLOB;
+            value.buffer_.assign(buf, buf + len);
+            value.length_ = static_cast<unsigned long>(len);
+        }
+        break;
+    case x_binary:
+        {
+            std::vector<uint8_t> const &v
+                = *static_cast<std::vector<uint8_t> const *>(data);
+
+            value.type_ = MYSQL_TYPE_BLOB;
+            value.buffer_.assign(v.begin(), v.end());
+            value.length_ = static_cast<unsigned long>(v.size());
+        }
+        break;
+    default:
+        throw soci_error("Use element used with non-supported type.");
+    }
+}
+
+void soci::details::mysql::get_bind_value(mysql_bind_value const &value,
+    exchange_type type, void *data)
+{
+    switch (type)
+    {
+    case x_char:
+        {
+            std::string const text = get_text(value);
+            *static_cast<char *>(data) = text.empty() ? '\0' : text[0];
+        }
+        break;
+    case x_stdstring:
+        {
+            std::string &dest = *static_cast<std::string *>(data);
+            switch (value.type_)
+            {
+            case MYSQL_TYPE_LONGLONG:
+                dest = value.unsigned_
+                    ? std::to_string(static_cast<unsigned long long>(value.integer_))
+                    : std::to_string(value.integer_);
+                break;
+            case MYSQL_TYPE_DOUBLE:
+                dest = double_to_cstring(value.double_);
+                break;
+            case MYSQL_TYPE_DATETIME:
+                {
+                    std::tm t = std::tm();
+                    get_bind_value(value, x_stdtm, &t);
+
+                    char buf[80];
+                    format_std_tm(t, buf, sizeof(buf));
+                    dest = buf;
+                }
+                break;
+            default:
+                if (value.buffer_.empty())
+                    dest.clear();
+                else
+                    dest.assign(&value.buffer_[0], value.length_);
+                break;
+            }
+        }
+        break;
+    case x_int8:
+        get_integer(value, *static_cast<int8_t *>(data));
+        break;
+    case x_uint8:
+        get_integer(value, *static_cast<uint8_t *>(data));
+        break;
+    case x_int16:
+        get_integer(value, *static_cast<int16_t *>(data));
+        break;
+    case x_uint16:
+        get_integer(value, *static_cast<uint16_t *>(data));
+        break;
+    case x_int32:
+        get_integer(value, *static_cast<int32_t *>(data));
+        break;
+    case x_uint32:
+        get_integer(value, *static_cast<uint32_t *>(data));
+        break;
+    case x_int64:
+        get_integer(value, *static_cast<int64_t *>(data));
+        break;
+    case x_uint64:
+        get_integer(value, *static_cast<uint64_t *>(data));
+        break;
+    case x_double:
+        {
+            double &d = *static_cast<double *>(data);
+            switch (value.type_)
+            {
+            case MYSQL_TYPE_DOUBLE:
+                d = value.double_;
+                break;
+            case MYSQL_TYPE_LONGLONG:
+                d = value.unsigned_
+                    ? static_cast<double>(static_cast<unsigned long long>(value.integer_))
+                    : static_cast<double>(value.integer_);
+                break;
+            default:
+                parse_num(get_text(value).c_str(), d);
+                break;
+            }
+        }
+        break;
+    case x_stdtm:
+        {
+            std::tm &t = *static_cast<std::tm *>(data);
+            if (value.type_ == MYSQL_TYPE_DATETIME)
+            {
+                MYSQL_TIME const &mt = value.time_;
+                mktime_from_ymdhms(t,
+                    static_cast<int>(mt.year), static_cast<int>(mt.month),
+                    static_cast<int>(mt.day), static_cast<int>(mt.hour),
+                    static_cast<int>(mt.minute), static_cast<int>(mt.second));
+            }
+            else
+            {
+                parse_std_tm(get_text(value).c_str(), t);
+            }
+        }
+        break;
+    case x_blob:
+        {
+            blob &b = *static_cast<blob *>(data);
+            mysql_blob_backend *bbe =
+                static_cast<mysql_blob_backend *>(b.get_backend());
+
+            if (value.type_ != MYSQL_TYPE_STRING && value.type_ != MYSQL_TYPE_BLOB)
+            {
+                throw soci_error("Cannot convert data.");
+            }
+
+            bbe->set_data(value.buffer_.empty() ? NULL : &value.buffer_[0],
+                value.length_);
+        }
+        break;
+    case x_binary:
+        {
+            std::vector<uint8_t> &v = *static_cast<std::vector<uint8_t> *>(data);
+
+            if (value.type_ != MYSQL_TYPE_STRING && value.type_ != MYSQL_TYPE_BLOB)
+            {
+                throw soci_error("Cannot convert data.");
+            }
+
+            if (value.buffer_.empty())
+                v.clear();
+            else
+                v.assign(&value.buffer_[0], &value.buffer_[0] + value.length_);
+        }
+        break;
+    default:
+        throw soci_error("Into element used with non-supported type.");
+    }
+}
@@ -81,6 +81,17 @@ std::size_t get_vector_size(void *p)
     return v->size();
 }
 
+// Return the pointer to the element of the vector with the given index.
+void * get_vector_element(void *p, exchange_type type, std::size_t index);
+
+// helpers for exchanging data using the binary protocol: the first one fills
+// the value with the data of the given type and the second one stores the
+// value into it, converting it if necessary
+void set_bind_value(mysql_bind_value &value,
+    exchange_type type, void const *data);
+void get_bind_value(mysql_bind_value const &value,
+    exchange_type type, void *data);
+
 } // namespace mysql
 
 } // namespace details
@@ -9,13 +9,20 @@
 #define SOCI_MYSQL_SOURCE
 #include "soci/mysql/soci-mysql.h"
 #include "soci/connection-parameters.h"
+#include "common.h"
+#include "soci-dtocstr.h"
+#include "soci-exchange-cast.h"
+#include "soci-mktime.h"
 // std
+#include <algorithm>
 #include <cctype>
 #include <cerrno>
 #include <ciso646>
 #include <climits>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <string>
 
 #ifdef _MSC_VER
@@ -24,6 +31,7 @@
 
 using namespace soci;
 using namespace soci::details;
+using namespace soci::details::mysql;
 using std::string;
 
 // SSL options existing in all supported MySQL versions but not in MariaDB.
@@ -205,7 +213,9 @@ void parse_connect_string(const string & connectString,
     unsigned int *connect_timeout, bool *connect_timeout_p,
     unsigned int *read_timeout, bool *read_timeout_p,
     unsigned int *write_timeout, bool *write_timeout_p,
-    unsigned int *ssl_mode, bool *ssl_mode_p)
+    unsigned int *ssl_mode, bool *ssl_mode_p,
+    int *prepared, bool *prepared_p,
+    int *streaming, bool *streaming_p)
 {
     *host_p = false;
     *user_p = false;
@@ -223,6 +233,8 @@ void parse_connect_string(const string & connectString,
     *read_timeout_p = false;
     *write_timeout_p = false;
     *ssl_mode_p = false;
+    *prepared_p = false;
+    *streaming_p = false;
     string err = "Malformed connection string.";
     string::const_iterator i = connectString.begin(),
         end = connectString.end();
@@ -356,6 +368,32 @@ void parse_connect_string(const string & connectString,
             throw soci_error("SSL options not supported with MariaDB");
 #endif
         }
+        else if (par == "prepared" && !*prepared_p)
+        {
+            if (!valid_int(val))
+            {
+                throw soci_error(err);
+            }
+            *prepared = std::atoi(val.c_str());
+            if (*prepared != 0 && *prepared != 1)
+            {
+                throw soci_error(err);
+            }
+            *prepared_p = true;
+        }
+        else if (par == "streaming" && !*streaming_p)
+        {
+            if (!valid_int(val))
+            {
+                throw soci_error(err);
+            }
+            *streaming = std::atoi(val.c_str());
+            if (*streaming != 0 && *streaming != 1)
+            {
+                throw soci_error(err);
+            }
+            *streaming_p = true;
+        }
         else
         {
             throw soci_error(err);
@@ -379,16 +417,19 @@ void parse_connect_string(const string & connectString,
 
 mysql_session_backend::mysql_session_backend(
     connection_parameters const & parameters)
+    : usePreparedStatements_(false), useStreaming_(false),
+      maxAllowedPacket_(0)
 {
     mysql_library::ensure_initialized();
 
     string host, user, password, db, unix_socket, ssl_ca, ssl_cert, ssl_key,
         charset;
-    int port, local_infile;
+    int port, local_infile, prepared, streaming;
     unsigned int connect_timeout, read_timeout, write_timeout, ssl_mode;
     bool host_p, user_p, password_p, db_p, unix_socket_p, port_p,
         ssl_ca_p, ssl_cert_p, ssl_key_p, local_infile_p, charset_p, reconnect_p,
-        connect_timeout_p, read_timeout_p, write_timeout_p, ssl_mode_p;
+        connect_timeout_p, read_timeout_p, write_timeout_p, ssl_mode_p,
+        prepared_p, streaming_p;
     parse_connect_string(parameters.get_connect_string(), &host, &host_p, &user, &user_p,
         &password, &password_p, &db, &db_p,
         &unix_socket, &unix_socket_p, &port, &port_p,
@@ -397,12 +438,22 @@ mysql_session_backend::mysql_session_backend(
         &connect_timeout, &connect_timeout_p,
         &read_timeout, &read_timeout_p,
         &write_timeout, &write_timeout_p,
-        &ssl_mode, &ssl_mode_p);
+        &ssl_mode, &ssl_mode_p,
+        &prepared, &prepared_p,
+        &streaming, &streaming_p);
     conn_ = mysql_init(NULL);
     if (conn_ == NULL)
     {
         throw soci_error("mysql_init() failed.");
     }
+    if (prepared_p && prepared == 1)
+    {
+        usePreparedStatements_ = true;
+    }
+    if (streaming_p && streaming == 1)
+    {
+        useStreaming_ = true;
+    }
     if (reconnect_p)
     {
         #if MYSQL_VERSION_ID < 8
@@ -582,6 +633,300 @@ void mysql_session_backend::clean_up()
     }
 }
 
+std::size_t mysql_session_backend::get_max_allowed_packet()
+{
+    if (maxAllowedPacket_ == 0)
+    {
+        hard_exec(conn_, "SELECT @@max_allowed_packet");
+
+        MYSQL_RES *res = mysql_store_result(conn_);
+        if (res == NULL)
+        {
+            throw mysql_soci_error(mysql_error(conn_), mysql_errno(conn_));
+        }
+
+        MYSQL_ROW row = mysql_fetch_row(res);
+        if (row != NULL && row[0] != NULL)
+        {
+            maxAllowedPacket_ = std::strtoul(row[0], NULL, 10);
+        }
+        mysql_free_result(res);
+
+        if (maxAllowedPacket_ == 0)
+        {
+            // This shouldn't happen, but use the minimal allowed value if it
+            // does.
+            maxAllowedPacket_ = 1024;
+        }
+    }
+
+    return maxAllowedPacket_;
+}
+
+namespace // unnamed
+{
+
+// State of LOAD DATA LOCAL INFILE statement used by the callbacks below.
+struct load_data_state
+{
+    load_data_state(mysql_data_loader const &loader, std::size_t numRows)
+        : loader_(loader), numRows_(numRows), row_(0), pos_(0) {}
+
+    mysql_data_loader const &loader_;
+    std::size_t const numRows_;
+    std::size_t row_;       // next row to format
+    string buffer_;         // formatted data
+    std::size_t pos_;       // start of the data not sent to the server yet
+    string error_;
+};
+
+// Append the string to the buffer escaping the special characters as
+// expected by LOAD DATA with the default ESCAPED BY '\\' clause.
+void append_escaped(string &buf, char const *s, std::size_t len)
+{
+    for (std::size_t i = 0; i != len; ++i)
+    {
+        switch (s[i])
+        {
+        case '\\': buf += "\\\\"; break;
+        case '\t': buf += "\\t"; break;
+        case '\n': buf += "\\n"; break;
+        case '\r': buf += "\\r"; break;
+        case '\0': buf += "\\0"; break;
+        default: buf += s[i]; break;
+        }
+    }
+}
+
+void append_value(string &buf, exchange_type type, void *data)
+{
+    switch (type)
+    {
+    case x_char:
+        append_escaped(buf, &exchange_type_cast<x_char>(data), 1);
+        break;
+    case x_stdstring:
+        {
+            string const &s = exchange_type_cast<x_stdstring>(data);
+            append_escaped(buf, s.c_str(), s.size());
+        }
+        break;
+    case x_int8:
+        buf += std::to_string(static_cast<int>(exchange_type_cast<x_int8>(data)));
+        break;
+    case x_uint8:
+        buf += std::to_string(static_cast<unsigned>(exchange_type_cast<x_uint8>(data)));
+        break;
+    case x_int16:
+        buf += std::to_string(exchange_type_cast<x_int16>(data));
+        break;
+    case x_uint16:
+        buf += std::to_string(exchange_type_cast<x_uint16>(data));
+        break;
+    case x_int32:
+        buf += std::to_string(exchange_type_cast<x_int32>(data));
+        break;
+    case x_uint32:
+        buf += std::to_string(exchange_type_cast<x_uint32>(data));
+        break;
+    case x_int64:
+        buf += std::to_string(exchange_type_cast<x_int64>(data));
+        break;
+    case x_uint64:
+        buf += std::to_string(exchange_type_cast<x_uint64>(data));
+        break;
+    case x_double:
+        {
+            double const d = exchange_type_cast<x_double>(data);
+            if (is_infinity_or_nan(d))
+            {
+                throw soci_error(
+                    "Infinity or NaN can't be loaded into MySQL.");
+            }
+            buf += double_to_cstring(d);
+        }
+        break;
+    case x_stdtm:
+        {
+            char tmp[80];
+            format_std_tm(exchange_type_cast<x_stdtm>(data), tmp, sizeof(tmp));
+            buf += tmp;
+        }
+        break;
+    default:
+        throw soci_error("Data loader column with non-supported type.");
+    }
+}
+
+void format_row(load_data_state &state)
+{
+    std::vector<mysql_data_loader::column_data> const &columns
+        = state.loader_.columns_;
+    for (std::size_t n = 0; n != columns.size(); ++n)
+    {
+        mysql_data_loader::column_data const &c = columns[n];
+        if (n != 0)
+        {
+            state.buffer_ += '\t';
+        }
+
+        if (c.ind_ != NULL && (*c.ind_)[state.row_] == i_null)
+        {
+            state.buffer_ += "\\N";
+            continue;
+        }
+
+        append_value(state.buffer_, c.type_,
+            get_vector_element(const_cast<void *>(c.data_), c.type_, state.row_));
+    }
+
+    state.buffer_ += '\n';
+}
+
+int load_data_init(void **ptr, const char * /* filename */, void *userdata)
+{
+    *ptr = userdata;
+    return 0;
+}
+
+int load_data_read(void *ptr, char *buf, unsigned int buf_len)
+{
+    load_data_state &state = *static_cast<load_data_state *>(ptr);
+
+    // Discard the already sent data and format just enough rows to fill the
+    // buffer, so that the memory use doesn't depend on the number of rows.
+    state.buffer_.erase(0, state.pos_);
+    state.pos_ = 0;
+    try
+    {
+        while (state.buffer_.size() < buf_len && state.row_ != state.numRows_)
+        {
+            format_row(state);
+            ++state.row_;
+        }
+    }
+    catch (std::exception const &e)
+    {
+        state.error_ = e.what();
+        return -1;
+    }
+    catch (...)
+    {
+        // No exceptions must propagate through the C library code.
+        state.error_ = "Unknown error while formatting the data to load.";
+        return -1;
+    }
+
+    std::size_t const len = (std::min)(
+        static_cast<std::size_t>(buf_len), state.buffer_.size());
+    std::memcpy(buf, state.buffer_.data(), len);
+    state.pos_ = len;
+
+    return static_cast<int>(len);
+}
+
+// Quote the given, possibly qualified, identifier.
+void append_quoted_identifier(std::string &query, std::string const &name)
+{
+    query += '`';
+    for (std::string::const_iterator it = name.begin(); it != name.end(); ++it)
+    {
+        if (*it == '`')
+        {
+            // Backticks inside the identifier must be doubled.
+            query += "``";
+        }
+        else if (*it == '.')
+        {
+            // Quote the database and table names separately.
+            query += "`.`";
+        }
+        else
+        {
+            query += *it;
+        }
+    }
+    query += '`';
+}
+
+void load_data_end(void * /* ptr */)
+{
+    // nothing to do here, the state is owned by load_data()
+}
+
+int load_data_error(void *ptr, char *error_msg, unsigned int error_msg_len)
+{
+    load_data_state &state = *static_cast<load_data_state *>(ptr);
+
+    if (error_msg_len != 0)
+    {
+        std::size_t const len = (std::min)(
+            static_cast<std::size_t>(error_msg_len - 1), state.error_.size());
+        std::memcpy(error_msg, state.error_.data(), len);
+        error_msg[len] = '\0';
+    }
+
+    return CR_UNKNOWN_ERROR;
+}
+
+} // namespace unnamed
+
+mysql_load_data_result mysql_session_backend::load_data(
+    mysql_data_loader const &loader)
+{
+    if (loader.columns_.empty())
+    {
+        throw soci_error("No columns to load.");
+    }
+
+    mysql_data_loader::column_data const &first = loader.columns_.front();
+    std::size_t const numRows = first.get_size_(first.data_);
+
+    string query = "LOAD DATA LOCAL INFILE 'soci' INTO TABLE ";
+    append_quoted_identifier(query, loader.table_);
+    query += " CHARACTER SET ";
+    query += mysql_character_set_name(conn_);
+    query += " FIELDS TERMINATED BY '\\t' ESCAPED BY '\\\\'"
+             " LINES TERMINATED BY '\\n' (";
+    for (std::size_t n = 0; n != loader.columns_.size(); ++n)
+    {
+        mysql_data_loader::column_data const &c = loader.columns_[n];
+        if (c.get_size_(c.data_) != numRows ||
+                (c.ind_ != NULL && c.ind_->size() != numRows))
+        {
+            throw soci_error("All loaded columns must have the same size.");
+        }
+
+        if (n != 0)
+        {
+            query += ", ";
+        }
+        append_quoted_identifier(query, c.name_);
+    }
+    query += ')';
+
+    load_data_state state(loader, numRows);
+    mysql_set_local_infile_handler(conn_,
+        load_data_init, load_data_read, load_data_end, load_data_error,
+        &state);
+
+    int const rc = mysql_real_query(conn_, query.c_str(),
+        static_cast<unsigned long>(query.size()));
+
+    mysql_set_local_infile_default(conn_);
+
+    if (rc != 0)
+    {
+        throw mysql_soci_error(mysql_error(conn_), mysql_errno(conn_));
+    }
+
+    mysql_load_data_result result;
+    result.rows_ = static_cast<unsigned long long>(mysql_affected_rows(conn_));
+    result.warnings_ = mysql_warning_count(conn_);
+
+    return result;
+}
+
 mysql_statement_backend * mysql_session_backend::make_statement_backend()
 {
     return new mysql_statement_backend(*this);
@@ -54,13 +54,35 @@ void mysql_standard_into_type_backend::post_fetch(
         return;
     }
 
-    if (gotData)
+    if (gotData && statement_.usePrepared_)
+    {
+        statement_.fetch_prepared_row(statement_.currentRow_);
+
+        mysql_bind_value const &value
+            = statement_.resultValues_[position_ - 1];
+        if (value.isNull_)
+        {
+            if (ind == NULL)
+            {
+                throw soci_error(
+                    "Null value fetched and no indicator defined.");
+            }
+            *ind = i_null;
+            return;
+        }
+
+        if (ind != NULL)
+        {
+            *ind = i_ok;
+        }
+
+        get_bind_value(value, type_, data_);
+    }
+    else if (gotData)
     {
         int pos = position_ - 1;
-        //mysql_data_seek(statement_.result_, statement_.currentRow_);
-        mysql_row_seek(statement_.result_,
-            statement_.resultRowOffsets_[statement_.currentRow_]);
-        MYSQL_ROW row = mysql_fetch_row(statement_.result_);
+        unsigned long *lengths;
+        MYSQL_ROW row = statement_.get_row(statement_.currentRow_, lengths);
         if (row[pos] == NULL)
         {
             if (ind == NULL)
@@ -87,8 +109,6 @@ void mysql_standard_into_type_backend::post_fetch(
         case x_stdstring:
             {
                 std::string& dest = exchange_type_cast<x_stdstring>(data_);
-                unsigned long * lengths =
-                    mysql_fetch_lengths(statement_.result_);
                 dest.assign(buf, lengths[pos]);
             }
             break;
@@ -143,7 +163,6 @@ void mysql_standard_into_type_backend::post_fetch(
             break;
         case x_blob:
             {
-                unsigned long * lengths = mysql_fetch_lengths(statement_.result_);
                 std::size_t size = lengths[pos];
                 blob &b = exchange_type_cast<x_blob>(data_);
 
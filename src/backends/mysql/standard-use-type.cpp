@@ -44,6 +44,30 @@ void mysql_standard_use_type_backend::bind_by_name(
 
 void mysql_standard_use_type_backend::pre_use(indicator const *ind)
 {
+    if (statement_.usePrepared_)
+    {
+        // the value is transferred in binary form, no formatting needed
+        if (ind != NULL && *ind == i_null)
+        {
+            value_.type_ = MYSQL_TYPE_NULL;
+        }
+        else
+        {
+            set_bind_value(value_, type_, data_);
+        }
+
+        if (position_ > 0)
+        {
+            statement_.useByPosValues_[position_] = &value_;
+        }
+        else
+        {
+            statement_.useByNameValues_[name_] = &value_;
+        }
+
+        return;
+    }
+
     if (ind != NULL && *ind == i_null)
     {
         buf_ = new char[5];
@@ -10,6 +10,10 @@
 #include "soci/mysql/soci-mysql.h"
 #include <cctype>
 #include <ciso646>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
 
 using namespace soci;
 using namespace soci::details;
@@ -19,12 +23,23 @@ using std::string;
 mysql_statement_backend::mysql_statement_backend(
     mysql_session_backend &session)
     : session_(session), result_(NULL),
+       usePrepared_(session.usePreparedStatements_), stmt_(NULL),
+       stmtPrepared_(false), preparedRow_(-1),
        rowsAffectedBulk_(-1LL), justDescribed_(false),
+       useStreaming_(session.useStreaming_), rewriteBulkInsert_(true),
        hasIntoElements_(false), hasVectorIntoElements_(false),
        hasUseElements_(false), hasVectorUseElements_(false)
 {
 }
 
+mysql_statement_backend::~mysql_statement_backend()
+{
+    if (stmt_ != NULL)
+    {
+        mysql_stmt_close(stmt_);
+    }
+}
+
 void mysql_statement_backend::alloc()
 {
     // nothing to do here.
@@ -41,12 +56,20 @@ void mysql_statement_backend::clean_up()
         mysql_free_result(result_);
         result_ = NULL;
     }
+
+    if (stmt_ != NULL)
+    {
+        mysql_stmt_free_result(stmt_);
+    }
+    preparedRow_ = -1;
 }
 
 void mysql_statement_backend::prepare(std::string const & query,
     statement_type /* eType */)
 {
     queryChunks_.clear();
+    names_.clear();
+    stmtPrepared_ = false;
     enum { eNormal, eInQuotes, eInName } state = eNormal;
 
     std::string name;
@@ -137,6 +160,11 @@ void mysql_statement_backend::prepare(std::string const & query,
 statement_backend::exec_fetch_result
 mysql_statement_backend::execute(int number)
 {
+    if (usePrepared_)
+    {
+        return execute_prepared(number);
+    }
+
     if (justDescribed_ == false)
     {
         clean_up();
@@ -163,49 +191,17 @@ mysql_statement_backend::execute(int number)
                     "Binding for use elements must be either by position "
                     "or by name.");
             }
+            if (numberOfExecutions > 1 && rewriteBulkInsert_ &&
+                    execute_multi_row_insert(numberOfExecutions))
+            {
+                return ef_no_data;
+            }
+
             long long rowsAffectedBulkTemp = -1;
             for (int i = 0; i != numberOfExecutions; ++i)
             {
                 std::vector<char *> paramValues;
-
-                if (not useByPosBuffers_.empty())
-                {
-                    // use elements bind by position
-                    // the map of use buffers can be traversed
-                    // in its natural order
-
-                    for (UseByPosBuffersMap::iterator
-                             it = useByPosBuffers_.begin(),
-                             end = useByPosBuffers_.end();
-                         it != end; ++it)
-                    {
-                        char **buffers = it->second;
-                        //cerr<<"i: "<<i<<", buffers[i]: "<<buffers[i]<<endl;
-                        paramValues.push_back(buffers[i]);
-                    }
-                }
-                else
-                {
-                    // use elements bind by name
-
-                    for (std::vector<std::string>::iterator
-                             it = names_.begin(), end = names_.end();
-                         it != end; ++it)
-                    {
-                        UseByNameBuffersMap::iterator b
-                            = useByNameBuffers_.find(*it);
-                        if (b == useByNameBuffers_.end())
-                        {
-                            std::string msg(
-                                "Missing use element for bind by name (");
-                            msg += *it;
-                            msg += ").";
-                            throw soci_error(msg);
-                        }
-                        char **buffers = b->second;
-                        paramValues.push_back(buffers[i]);
-                    }
-                }
+                get_param_values(i, paramValues);
                 //cerr << "queryChunks_.size(): "<<queryChunks_.size()<<endl;
                 //cerr << "paramValues.size(): "<<paramValues.size()<<endl;
                 if (queryChunks_.size() != paramValues.size()
@@ -274,13 +270,15 @@ mysql_statement_backend::execute(int number)
             throw mysql_soci_error(mysql_error(session_.conn_),
                 mysql_errno(session_.conn_));
         }
-        result_ = mysql_store_result(session_.conn_);
+        result_ = useStreaming_
+            ? mysql_use_result(session_.conn_)
+            : mysql_store_result(session_.conn_);
         if (result_ == NULL and mysql_field_count(session_.conn_) != 0)
         {
             throw mysql_soci_error(mysql_error(session_.conn_),
                 mysql_errno(session_.conn_));
         }
-        if (result_ != NULL)
+        if (result_ != NULL and not useStreaming_)
         {
             // Cache the rows offsets to have random access to the rows later.
             // [mysql_data_seek() is O(n) so we don't want to use it].
@@ -303,6 +301,13 @@ mysql_statement_backend::execute(int number)
         currentRow_ = 0;
         rowsToConsume_ = 0;
 
+        if (useStreaming_)
+        {
+            // The number of rows is unknown until we read all of them.
+            numberOfRows_ = 0;
+            return number > 0 ? fetch_streaming(number) : ef_success;
+        }
+
         numberOfRows_ = static_cast<int>(mysql_num_rows(result_));
         if (numberOfRows_ == 0)
         {
@@ -329,6 +334,624 @@ mysql_statement_backend::execute(int number)
     }
 }
 
+namespace // unnamed
+{
+
+void throw_stmt_error(MYSQL_STMT *stmt)
+{
+    throw mysql_soci_error(mysql_stmt_error(stmt), mysql_stmt_errno(stmt));
+}
+
+bool is_word_char(char c)
+{
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+bool starts_with_keyword(std::string const &s, std::size_t pos, char const *kw)
+{
+    std::size_t const len = std::strlen(kw);
+    if (s.size() < pos + len)
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0; i != len; ++i)
+    {
+        if (std::tolower(static_cast<unsigned char>(s[pos + i])) != kw[i])
+        {
+            return false;
+        }
+    }
+
+    return pos + len == s.size() || !is_word_char(s[pos + len]);
+}
+
+// Check if the query is a simple INSERT (or REPLACE) statement with a single
+// tuple of values, containing all the parameters, which can be repeated to
+// insert several rows at once. If so, return the position of the opening
+// parenthesis of the tuple in the first chunk and of the closing one in the
+// last chunk.
+bool find_values_tuple(std::vector<std::string> const &chunks,
+    std::size_t numParams, std::size_t &open, std::size_t &close)
+{
+    // We need at least one parameter inside the tuple and nothing after the
+    // last chunk.
+    if (chunks.size() < 2 || numParams != chunks.size() - 1)
+    {
+        return false;
+    }
+
+    std::string const &first = chunks.front();
+    std::size_t pos = 0;
+    while (pos != first.size() && std::isspace(static_cast<unsigned char>(first[pos])))
+    {
+        ++pos;
+    }
+
+    if (!starts_with_keyword(first, pos, "insert") &&
+        !starts_with_keyword(first, pos, "replace"))
+    {
+        return false;
+    }
+
+    // Find the last "VALUES (" outside of the quotes in the first chunk.
+    open = std::string::npos;
+    bool inQuotes = false;
+    bool escaped = false;
+    for (; pos != first.size(); ++pos)
+    {
+        char const c = first[pos];
+        if (inQuotes)
+        {
+            if (c == '\'' && !escaped)
+            {
+                inQuotes = false;
+            }
+            escaped = c == '\\' && !escaped;
+            continue;
+        }
+
+        if (c == '\'')
+        {
+            inQuotes = true;
+        }
+        else if ((pos == 0 || !is_word_char(first[pos - 1])) &&
+                    starts_with_keyword(first, pos, "values"))
+        {
+            std::size_t next = pos + 6;
+            while (next != first.size() &&
+                    std::isspace(static_cast<unsigned char>(first[next])))
+            {
+                ++next;
+            }
+
+            if (next != first.size() && first[next] == '(')
+            {
+                open = next;
+            }
+        }
+    }
+
+    if (inQuotes || open == std::string::npos)
+    {
+        return false;
+    }
+
+    // Find the matching closing parenthesis, it must be in the last chunk.
+    int depth = 0;
+    for (std::size_t n = 0; n != chunks.size(); ++n)
+    {
+        std::string const &chunk = chunks[n];
+        for (pos = n == 0 ? open : 0; pos != chunk.size(); ++pos)
+        {
+            char const c = chunk[pos];
+            if (inQuotes)
+            {
+                if (c == '\'' && !escaped)
+                {
+                    inQuotes = false;
+                }
+                escaped = c == '\\' && !escaped;
+                continue;
+            }
+
+            switch (c)
+            {
+            case '\'':
+                inQuotes = true;
+                break;
+            case '(':
+                ++depth;
+                break;
+            case ')':
+                if (--depth == 0)
+                {
+                    if (n != chunks.size() - 1)
+                    {
+                        return false;
+                    }
+
+                    // Don't rewrite the statements inserting several tuples
+                    // already, e.g. "VALUES (:x), (1)".
+                    for (std::size_t i = pos + 1; i != chunk.size(); ++i)
+                    {
+                        if (chunk[i] == ',')
+                        {
+                            return false;
+                        }
+                        if (!std::isspace(static_cast<unsigned char>(chunk[i])))
+                        {
+                            break;
+                        }
+                    }
+
+                    close = pos;
+                    return true;
+                }
+                break;
+            }
+        }
+    }
+
+    return false;
+}
+
+} // namespace unnamed
+
+void mysql_statement_backend::get_param_values(int row,
+    std::vector<char *> &paramValues)
+{
+    if (not useByPosBuffers_.empty())
+    {
+        // use elements bind by position
+        // the map of use buffers can be traversed
+        // in its natural order
+
+        for (UseByPosBuffersMap::iterator
+                 it = useByPosBuffers_.begin(),
+                 end = useByPosBuffers_.end();
+             it != end; ++it)
+        {
+            char **buffers = it->second;
+            paramValues.push_back(buffers[row]);
+        }
+    }
+    else
+    {
+        // use elements bind by name
+
+        for (std::vector<std::string>::iterator
+                 it = names_.begin(), end = names_.end();
+             it != end; ++it)
+        {
+            UseByNameBuffersMap::iterator b
+                = useByNameBuffers_.find(*it);
+            if (b == useByNameBuffers_.end())
+            {
+                std::string msg(
+                    "Missing use element for bind by name (");
+                msg += *it;
+                msg += ").";
+                throw soci_error(msg);
+            }
+            char **buffers = b->second;
+            paramValues.push_back(buffers[row]);
+        }
+    }
+}
+
+bool mysql_statement_backend::execute_multi_row_insert(int numberOfRows)
+{
+    std::size_t open, close;
+    if (not find_values_tuple(queryChunks_, names_.size(), open, close))
+    {
+        return false;
+    }
+
+    std::string const &first = queryChunks_.front();
+    std::string const &last = queryChunks_.back();
+    std::string const prefix = first.substr(0, open);
+    std::string const suffix = last.substr(close + 1);
+
+    // Leave some space for the packet header.
+    std::size_t const maxAllowedPacket = session_.get_max_allowed_packet();
+    std::size_t const maxQuerySize
+        = maxAllowedPacket > 1024 ? maxAllowedPacket - 1024 : maxAllowedPacket;
+
+    long long rowsAffectedBulkTemp = -1;
+    std::string query;
+    std::string tuple;
+    int rowsInQuery = 0;
+    for (int i = 0; i <= numberOfRows; ++i)
+    {
+        if (i != numberOfRows)
+        {
+            std::vector<char *> paramValues;
+            get_param_values(i, paramValues);
+            if (paramValues.size() + 1 != queryChunks_.size())
+            {
+                throw soci_error("Wrong number of parameters.");
+            }
+
+            tuple.assign(first, open, std::string::npos);
+            for (std::size_t n = 0; n != paramValues.size(); ++n)
+            {
+                tuple += paramValues[n];
+                if (n + 2 == queryChunks_.size())
+                {
+                    tuple.append(last, 0, close + 1);
+                }
+                else
+                {
+                    tuple += queryChunks_[n + 1];
+                }
+            }
+        }
+
+        // Send the accumulated rows if we're done or if adding this one
+        // would make the query too big.
+        if (rowsInQuery != 0 &&
+                (i == numberOfRows ||
+                 query.size() + 1 + tuple.size() + suffix.size() > maxQuerySize))
+        {
+            query += suffix;
+            if (0 != mysql_real_query(session_.conn_, query.c_str(),
+                    static_cast<unsigned long>(query.size())))
+            {
+                // preserve the number of rows affected so far.
+                rowsAffectedBulk_ = rowsAffectedBulkTemp;
+                throw mysql_soci_error(mysql_error(session_.conn_),
+                    mysql_errno(session_.conn_));
+            }
+
+            if (rowsAffectedBulkTemp == -1)
+            {
+                rowsAffectedBulkTemp = 0;
+            }
+            rowsAffectedBulkTemp += static_cast<long long>(
+                mysql_affected_rows(session_.conn_));
+
+            if (mysql_field_count(session_.conn_) != 0)
+            {
+                throw soci_error("The query shouldn't have returned"
+                    " any data but it did.");
+            }
+
+            rowsInQuery = 0;
+        }
+
+        if (i == numberOfRows)
+        {
+            break;
+        }
+
+        if (rowsInQuery == 0)
+        {
+            query = prefix;
+        }
+        else
+        {
+            query += ',';
+        }
+        query += tuple;
+        ++rowsInQuery;
+    }
+
+    rowsAffectedBulk_ = rowsAffectedBulkTemp;
+    return true;
+}
+
+statement_backend::exec_fetch_result
+mysql_statement_backend::execute_prepared(int number)
+{
+    if (justDescribed_ == false)
+    {
+        clean_up();
+
+        if (number > 1 && hasIntoElements_)
+        {
+             throw soci_error(
+                  "Bulk use with single into elements is not supported.");
+        }
+        // number - size of vectors (into/use)
+        // numberOfExecutions - number of loops to perform
+        int numberOfExecutions = 1;
+        if (number > 0)
+        {
+             numberOfExecutions = hasUseElements_ ? 1 : number;
+        }
+
+        if (stmt_ == NULL)
+        {
+            stmt_ = mysql_stmt_init(session_.conn_);
+            if (stmt_ == NULL)
+            {
+                throw mysql_soci_error(mysql_error(session_.conn_),
+                    mysql_errno(session_.conn_));
+            }
+        }
+
+        if (!stmtPrepared_)
+        {
+            // The statement only needs to be parsed by the server once, even
+            // if it's executed many times. Use the positional placeholders
+            // instead of the named ones in the query sent to it.
+            std::string query;
+            for (std::size_t i = 0; i != queryChunks_.size(); ++i)
+            {
+                query += queryChunks_[i];
+                if (i < names_.size())
+                {
+                    query += '?';
+                }
+            }
+
+            if (0 != mysql_stmt_prepare(stmt_, query.c_str(),
+                    static_cast<unsigned long>(query.size())))
+            {
+                throw_stmt_error(stmt_);
+            }
+
+            stmtPrepared_ = true;
+        }
+
+        std::vector<mysql_bind_value *> paramValues;
+        if (not useByPosValues_.empty() and not useByNameValues_.empty())
+        {
+            throw soci_error(
+                "Binding for use elements must be either by position "
+                "or by name.");
+        }
+        if (not useByPosValues_.empty())
+        {
+            for (UseByPosValuesMap::iterator it = useByPosValues_.begin(),
+                     end = useByPosValues_.end();
+                 it != end; ++it)
+            {
+                paramValues.push_back(it->second);
+            }
+        }
+        else if (not useByNameValues_.empty())
+        {
+            for (std::vector<std::string>::iterator
+                     it = names_.begin(), end = names_.end();
+                 it != end; ++it)
+            {
+                UseByNameValuesMap::iterator v = useByNameValues_.find(*it);
+                if (v == useByNameValues_.end())
+                {
+                    std::string msg(
+                        "Missing use element for bind by name (");
+                    msg += *it;
+                    msg += ").";
+                    throw soci_error(msg);
+                }
+                paramValues.push_back(v->second);
+            }
+        }
+
+        if (paramValues.size() != mysql_stmt_param_count(stmt_))
+        {
+            throw soci_error("Wrong number of parameters.");
+        }
+
+        std::vector<MYSQL_BIND> paramBinds(paramValues.size());
+        long long rowsAffectedBulkTemp = -1;
+        for (int i = 0; i != numberOfExecutions; ++i)
+        {
+            if (not paramBinds.empty())
+            {
+                for (std::size_t n = 0; n != paramValues.size(); ++n)
+                {
+                    paramValues[n][i].bind(paramBinds[n]);
+                }
+
+                if (mysql_stmt_bind_param(stmt_, &paramBinds[0]))
+                {
+                    throw_stmt_error(stmt_);
+                }
+            }
+
+            if (0 != mysql_stmt_execute(stmt_))
+            {
+                if (numberOfExecutions > 1)
+                {
+                    // preserve the number of rows affected so far.
+                    rowsAffectedBulk_ = rowsAffectedBulkTemp;
+                }
+                throw_stmt_error(stmt_);
+            }
+
+            if (numberOfExecutions > 1)
+            {
+                if (rowsAffectedBulkTemp == -1)
+                {
+                    rowsAffectedBulkTemp = 0;
+                }
+                rowsAffectedBulkTemp += static_cast<long long>(
+                    mysql_stmt_affected_rows(stmt_));
+
+                if (mysql_stmt_field_count(stmt_) != 0)
+                {
+                    throw soci_error("The query shouldn't have returned"
+                        " any data but it did.");
+                }
+            }
+        }
+
+        if (numberOfExecutions > 1)
+        {
+            // bulk
+            rowsAffectedBulk_ = rowsAffectedBulkTemp;
+            return ef_no_data;
+        }
+
+        result_ = mysql_stmt_result_metadata(stmt_);
+        if (result_ == NULL and mysql_stmt_field_count(stmt_) != 0)
+        {
+            throw_stmt_error(stmt_);
+        }
+        if (result_ != NULL)
+        {
+            // Ask the server to compute the maximal length of the columns to
+            // allocate big enough buffers for them in bind_prepared_results().
+            details::mysql::bind_bool const updateMaxLength = 1;
+            mysql_stmt_attr_set(stmt_, STMT_ATTR_UPDATE_MAX_LENGTH,
+                &updateMaxLength);
+
+            if (0 != mysql_stmt_store_result(stmt_))
+            {
+                throw_stmt_error(stmt_);
+            }
+
+            // Cache the rows offsets as in the non-prepared case, this must
+            // be done before binding the results to avoid converting them.
+            int numrows = static_cast<int>(mysql_stmt_num_rows(stmt_));
+            resultRowOffsets_.resize(numrows);
+            for (int i = 0; i < numrows; i++)
+            {
+                resultRowOffsets_[i] = mysql_stmt_row_tell(stmt_);
+                mysql_stmt_fetch(stmt_);
+            }
+
+            bind_prepared_results();
+        }
+    }
+    else
+    {
+        justDescribed_ = false;
+    }
+
+    if (result_ != NULL)
+    {
+        currentRow_ = 0;
+        rowsToConsume_ = 0;
+
+        numberOfRows_ = static_cast<int>(mysql_stmt_num_rows(stmt_));
+        if (numberOfRows_ == 0)
+        {
+            return ef_no_data;
+        }
+        else
+        {
+            if (number > 0)
+            {
+                // prepare for the subsequent data consumption
+                return fetch(number);
+            }
+            else
+            {
+                // execute(0) was meant to only perform the query
+                return ef_success;
+            }
+        }
+    }
+    else
+    {
+        // it was not a SELECT
+        return ef_no_data;
+    }
+}
+
+void mysql_statement_backend::bind_prepared_results()
+{
+    unsigned int const numCols = mysql_num_fields(result_);
+    resultValues_.resize(numCols);
+    resultBinds_.resize(numCols);
+
+    for (unsigned int i = 0; i != numCols; ++i)
+    {
+        MYSQL_FIELD *field = mysql_fetch_field_direct(result_, i);
+        mysql_bind_value &value = resultValues_[i];
+
+        value.unsigned_ = false;
+        switch (field->type)
+        {
+        case MYSQL_TYPE_TINY:
+        case MYSQL_TYPE_SHORT:
+        case MYSQL_TYPE_INT24:
+        case MYSQL_TYPE_LONG:
+        case MYSQL_TYPE_LONGLONG:
+            value.type_ = MYSQL_TYPE_LONGLONG;
+            value.unsigned_ = (field->flags & UNSIGNED_FLAG) != 0;
+            break;
+        case MYSQL_TYPE_FLOAT:
+        case MYSQL_TYPE_DOUBLE:
+            value.type_ = MYSQL_TYPE_DOUBLE;
+            break;
+        case MYSQL_TYPE_TIMESTAMP:
+        case MYSQL_TYPE_DATE:
+        case MYSQL_TYPE_DATETIME:
+            value.type_ = MYSQL_TYPE_DATETIME;
+            break;
+        default:
+            // Everything else, including DECIMAL, TIME and YEAR values, is
+            // retrieved in text form and converted in the same way as when
+            // not using prepared statements.
+            value.type_ = MYSQL_TYPE_STRING;
+            value.buffer_.resize(field->max_length + 1);
+            break;
+        }
+
+        value.bind(resultBinds_[i]);
+    }
+
+    if (numCols != 0 && mysql_stmt_bind_result(stmt_, &resultBinds_[0]))
+    {
+        throw_stmt_error(stmt_);
+    }
+
+    preparedRow_ = -1;
+}
+
+void mysql_statement_backend::fetch_prepared_row(int row)
+{
+    // All into elements use the same row, only fetch it once.
+    if (row == preparedRow_)
+    {
+        return;
+    }
+
+    mysql_stmt_row_seek(stmt_, resultRowOffsets_[row]);
+    int const res = mysql_stmt_fetch(stmt_);
+    if (res == MYSQL_DATA_TRUNCATED)
+    {
+        // This can only happen for the text columns if their maximal length
+        // wasn't computed by the server, grow their buffers as needed.
+        for (std::size_t i = 0; i != resultValues_.size(); ++i)
+        {
+            mysql_bind_value &value = resultValues_[i];
+            if (!value.error_)
+            {
+                continue;
+            }
+
+            value.buffer_.resize(value.length_ + 1);
+            value.bind(resultBinds_[i]);
+            if (0 != mysql_stmt_fetch_column(stmt_, &resultBinds_[i],
+                    static_cast<unsigned int>(i), 0))
+            {
+                throw_stmt_error(stmt_);
+            }
+        }
+
+        if (mysql_stmt_bind_result(stmt_, &resultBinds_[0]))
+        {
+            throw_stmt_error(stmt_);
+        }
+    }
+    else if (res == MYSQL_NO_DATA)
+    {
+        throw soci_error("Unexpected end of prepared statement results.");
+    }
+    else if (res != 0)
+    {
+        throw_stmt_error(stmt_);
+    }
+
+    preparedRow_ = row;
+}
+
 statement_backend::exec_fetch_result
 mysql_statement_backend::fetch(int number)
 {
@@ -338,6 +961,11 @@ mysql_statement_backend::fetch(int number)
     // in the postFetch functions, called for each into element.
     // Here, we only prepare for this to happen (to emulate "the Oracle way").
 
+    if (useStreaming_ && !usePrepared_)
+    {
+        return fetch_streaming(number);
+    }
+
     // forward the "cursor" from the last fetch
     currentRow_ += rowsToConsume_;
 
@@ -365,12 +993,97 @@ mysql_statement_backend::fetch(int number)
     }
 }
 
+statement_backend::exec_fetch_result
+mysql_statement_backend::fetch_streaming(int number)
+{
+    // forward the "cursor" from the last fetch
+    currentRow_ += rowsToConsume_;
+    rowsToConsume_ = 0;
+
+    streamData_.clear();
+    streamOffsets_.clear();
+    streamLengths_.clear();
+
+    unsigned int const numCols = mysql_num_fields(result_);
+    bool endOfRows = false;
+    while (rowsToConsume_ != number)
+    {
+        MYSQL_ROW row = mysql_fetch_row(result_);
+        if (row == NULL)
+        {
+            if (mysql_errno(session_.conn_) != 0)
+            {
+                throw mysql_soci_error(mysql_error(session_.conn_),
+                    mysql_errno(session_.conn_));
+            }
+
+            endOfRows = true;
+            break;
+        }
+
+        unsigned long *lengths = mysql_fetch_lengths(result_);
+        for (unsigned int i = 0; i != numCols; ++i)
+        {
+            if (row[i] == NULL)
+            {
+                streamOffsets_.push_back(static_cast<std::size_t>(-1));
+                streamLengths_.push_back(0);
+                continue;
+            }
+
+            // Keep the data NUL-terminated as the into elements expect it.
+            streamOffsets_.push_back(streamData_.size());
+            streamLengths_.push_back(lengths[i]);
+            streamData_.insert(streamData_.end(), row[i], row[i] + lengths[i]);
+            streamData_.push_back('\0');
+        }
+
+        ++rowsToConsume_;
+    }
+
+    // Now that the data buffer won't be reallocated any more, we can
+    // compute the pointers to the cells.
+    streamCells_.resize(streamOffsets_.size());
+    for (std::size_t i = 0; i != streamOffsets_.size(); ++i)
+    {
+        streamCells_[i] = streamOffsets_[i] == static_cast<std::size_t>(-1)
+            ? NULL
+            : &streamData_[streamOffsets_[i]];
+    }
+
+    numberOfRows_ = currentRow_ + rowsToConsume_;
+
+    // As in fetch(), return ef_no_data when EOF is hit, even if some rows
+    // were fetched.
+    return endOfRows ? ef_no_data : ef_success;
+}
+
+MYSQL_ROW mysql_statement_backend::get_row(int row, unsigned long *&lengths)
+{
+    if (useStreaming_)
+    {
+        std::size_t const start = static_cast<std::size_t>(row - currentRow_)
+            * mysql_num_fields(result_);
+        lengths = &streamLengths_[start];
+        return &streamCells_[start];
+    }
+
+    mysql_row_seek(result_, resultRowOffsets_[row]);
+    MYSQL_ROW r = mysql_fetch_row(result_);
+    lengths = mysql_fetch_lengths(result_);
+    return r;
+}
+
 long long mysql_statement_backend::get_affected_rows()
 {
     if (rowsAffectedBulk_ >= 0)
     {
         return rowsAffectedBulk_;
     }
+    if (usePrepared_ && stmt_ != NULL)
+    {
+        return static_cast<long long>(mysql_stmt_affected_rows(stmt_));
+    }
     return static_cast<long long>(mysql_affected_rows(session_.conn_));
 }
 
@@ -394,10 +1107,14 @@ std::string mysql_statement_backend::rewrite_for_procedure_call(
 
 int mysql_statement_backend::prepare_for_describe()
 {
-    execute(1);
+    // In streaming mode we can't read the first row here as it would be
+    // lost, but we don't need it to describe the columns anyhow.
+    execute(useStreaming_ && !usePrepared_ ? 0 : 1);
     justDescribed_ = true;
 
-    int columns = mysql_field_count(session_.conn_);
+    int columns = usePrepared_
+        ? static_cast<int>(mysql_stmt_field_count(stmt_))
+        : static_cast<int>(mysql_field_count(session_.conn_));
     return columns;
 }
 
@@ -49,7 +49,36 @@ void set_invector_(void *p, int indx, T const &val)
 
 void mysql_vector_into_type_backend::post_fetch(bool gotData, indicator *ind)
 {
-    if (gotData)
+    if (gotData && statement_.usePrepared_)
+    {
+        mysql_bind_value const &value
+            = statement_.resultValues_[position_ - 1];
+
+        for (int i = 0; i != statement_.rowsToConsume_; ++i)
+        {
+            statement_.fetch_prepared_row(statement_.currentRow_ + i);
+
+            if (value.isNull_)
+            {
+                if (ind == NULL)
+                {
+                    throw soci_error(
+                        "Null value fetched and no indicator defined.");
+                }
+
+                ind[i] = i_null;
+                continue;
+            }
+
+            if (ind != NULL)
+            {
+                ind[i] = i_ok;
+            }
+
+            get_bind_value(value, type_, get_vector_element(data_, type_, i));
+        }
+    }
+    else if (gotData)
     {
         // Here, rowsToConsume_ in the Statement object designates
         // the number of rows that need to be put in the user's buffers.
@@ -59,13 +88,11 @@ void mysql_vector_into_type_backend::post_fetch(bool gotData, indicator *ind)
 
         int const endRow = statement_.currentRow_ + statement_.rowsToConsume_;
 
-        //mysql_data_seek(statement_.result_, statement_.currentRow_);
-        mysql_row_seek(statement_.result_,
-            statement_.resultRowOffsets_[statement_.currentRow_]);
         for (int curRow = statement_.currentRow_, i = 0;
              curRow != endRow; ++curRow, ++i)
         {
-            MYSQL_ROW row = mysql_fetch_row(statement_.result_);
+            unsigned long *lengths;
+            MYSQL_ROW row = statement_.get_row(curRow, lengths);
             // first, deal with indicators
             if (row[pos] == NULL)
             {
@@ -98,8 +125,6 @@ void mysql_vector_into_type_backend::post_fetch(bool gotData, indicator *ind)
                 break;
             case x_stdstring:
                 {
-                    unsigned long * lengths =
-                        mysql_fetch_lengths(statement_.result_);
                     // Not sure if it's necessary, but the code below is used
                     // instead of
                     // set_invector_(data_, i, std::string(buf, lengths[pos]);
@@ -109,6 +134,13 @@ void mysql_vector_into_type_backend::post_fetch(bool gotData, indicator *ind)
                     (*dest)[i].assign(buf, lengths[pos]);
                 }
                 break;
+            case x_binary:
+                {
+                    std::vector<std::vector<uint8_t> > *dest =
+                        static_cast<std::vector<std::vector<uint8_t> > *>(data_);
+                    (*dest)[i].assign(buf, buf + lengths[pos]);
+                }
+                break;
             case x_int8:
                 {
                     int32_t tmp = 0;
@@ -224,6 +256,7 @@ void mysql_vector_into_type_backend::resize(std::size_t sz)
     case x_double:       resizevector_<double>       (data_, sz); break;
     case x_stdstring:    resizevector_<std::string>  (data_, sz); break;
     case x_stdtm:        resizevector_<std::tm>      (data_, sz); break;
+    case x_binary:       resizevector_<std::vector<uint8_t> >(data_, sz); break;
 
     default:
         throw soci_error("Into vector element used with non-supported type.");
@@ -248,6 +281,7 @@ std::size_t mysql_vector_into_type_backend::size()
     case x_double:       sz = get_vector_size<double>       (data_); break;
     case x_stdstring:    sz = get_vector_size<std::string>  (data_); break;
     case x_stdtm:        sz = get_vector_size<std::tm>      (data_); break;
+    case x_binary:       sz = get_vector_size<std::vector<uint8_t> >(data_); break;
 
     default:
         throw soci_error("Into vector element used with non-supported type.");
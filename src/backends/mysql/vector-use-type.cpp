@@ -48,6 +48,37 @@ void mysql_vector_use_type_backend::bind_by_name(
 void mysql_vector_use_type_backend::pre_use(indicator const *ind)
 {
     std::size_t const vsize = size();
+
+    if (statement_.usePrepared_)
+    {
+        // the values are transferred in binary form, no formatting needed
+        values_.resize(vsize);
+        for (std::size_t i = 0; i != vsize; ++i)
+        {
+            if (ind != NULL && ind[i] == i_null)
+            {
+                values_[i].type_ = MYSQL_TYPE_NULL;
+            }
+            else
+            {
+                set_bind_value(values_[i], type_,
+                    get_vector_element(data_, type_, i));
+            }
+        }
+
+        mysql_bind_value *values = vsize ? &values_[0] : NULL;
+        if (position_ > 0)
+        {
+            statement_.useByPosValues_[position_] = values;
+        }
+        else
+        {
+            statement_.useByNameValues_[name_] = values;
+        }
+
+        return;
+    }
+
     for (size_t i = 0; i != vsize; ++i)
     {
         char *buf;
@@ -83,6 +114,19 @@ void mysql_vector_use_type_backend::pre_use(indicator const *ind)
                         v[i].c_str(), v[i].size());
                 }
                 break;
+            case x_binary:
+                {
+                    std::vector<std::vector<uint8_t> > *pv
+                        = static_cast<std::vector<std::vector<uint8_t> > *>(data_);
+                    std::vector<uint8_t> &v = (*pv)[i];
+
+                    // mysql_real_escape_string() escapes the NUL bytes too,
+                    // so binary data can be quoted in the same way as text.
+                    buf = quote(statement_.session_.conn_,
+                        v.empty() ? "" : reinterpret_cast<char const *>(&v[0]),
+                        v.size());
+                }
+                break;
             case x_int8:
                 {
                     std::vector<int8_t> *pv
@@ -255,6 +299,7 @@ std::size_t mysql_vector_use_type_backend::size()
     case x_double:       sz = get_vector_size<double>       (data_); break;
     case x_stdstring:    sz = get_vector_size<std::string>  (data_); break;
     case x_stdtm:        sz = get_vector_size<std::tm>      (data_); break;
+    case x_binary:       sz = get_vector_size<std::vector<uint8_t> >(data_); break;
 
     default:
         throw soci_error("Use vector element used with non-supported type.");
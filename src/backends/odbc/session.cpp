@@ -11,17 +11,90 @@
 #include "soci/session.h"
 
 #include "soci-autostatement.h"
+#include "soci-case.h"
 
+#include <cctype>
 #include <cstdio>
+#include <sstream>
 
 using namespace soci;
 using namespace soci::details;
 
 char const * soci::odbc_option_driver_complete = "odbc.driver_complete";
+char const * soci::odbc_option_statement_cache = "odbc.statement_cache";
+
+namespace
+{
+
+// Check if the query may change the database schema, which makes the column
+// information of the already prepared statements out of date.
+bool is_schema_changing_query(std::string const& query)
+{
+    std::string::size_type const start = query.find_first_not_of(" \t\r\n(");
+    if (start == std::string::npos)
+        return false;
+
+    std::string::size_type end = start;
+    while (end < query.size() && std::isalpha(static_cast<unsigned char>(query[end])))
+        ++end;
+
+    std::string const keyword = string_tolower(query.substr(start, end - start));
+    return keyword == "create" || keyword == "drop" || keyword == "alter";
+}
+
+// Check if committing or rolling back a transaction, including doing it
+// implicitly in auto-commit mode, deletes the prepared statements, which
+// makes it impossible to reuse them.
+bool transactions_delete_prepared_statements(SQLHDBC hdbc)
+{
+    SQLUSMALLINT const infoTypes[] =
+        { SQL_CURSOR_COMMIT_BEHAVIOR, SQL_CURSOR_ROLLBACK_BEHAVIOR };
+
+    for (std::size_t i = 0; i != sizeof(infoTypes)/sizeof(infoTypes[0]); ++i)
+    {
+        SQLUSMALLINT behavior = SQL_CB_DELETE;
+        SQLRETURN rc = SQLGetInfo(hdbc, infoTypes[i],
+                                  &behavior, sizeof(behavior), NULL);
+        if (is_odbc_error(rc) || behavior == SQL_CB_DELETE)
+            return true;
+    }
+
+    return false;
+}
+
+// Reset the statement handle to the same state as a newly allocated one,
+// return false if this couldn't be done.
+bool reset_statement(SQLHSTMT hstmt)
+{
+    if (is_odbc_error(SQLFreeStmt(hstmt, SQL_CLOSE)) ||
+        is_odbc_error(SQLFreeStmt(hstmt, SQL_UNBIND)) ||
+        is_odbc_error(SQLFreeStmt(hstmt, SQL_RESET_PARAMS)))
+        return false;
+
+    // Also restore all the attributes which can be changed by the statement
+    // backend to their default values.
+    return
+        !is_odbc_error(SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_BIND_TYPE,
+                                      (SQLPOINTER)SQL_BIND_BY_COLUMN, 0)) &&
+        !is_odbc_error(SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_ARRAY_SIZE,
+                                      (SQLPOINTER)1, 0)) &&
+        !is_odbc_error(SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR,
+                                      NULL, 0)) &&
+        !is_odbc_error(SQLSetStmtAttr(hstmt, SQL_ATTR_PARAM_BIND_TYPE,
+                                      (SQLPOINTER)SQL_PARAM_BIND_BY_COLUMN, 0)) &&
+        !is_odbc_error(SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMSET_SIZE,
+                                      (SQLPOINTER)1, 0)) &&
+        !is_odbc_error(SQLSetStmtAttr(hstmt, SQL_ATTR_PARAMS_PROCESSED_PTR,
+                                      NULL, 0));
+}
+
+} // anonymous namespace
 
 odbc_session_backend::odbc_session_backend(
     connection_parameters const & parameters)
-    : henv_(0), hdbc_(0), product_(prod_uninitialized)
+    : henv_(0), hdbc_(0), product_(prod_uninitialized),
+      dataExtensions_(0), dataExtensionsKnown_(false),
+      statementCacheSize_(0)
 {
     SQLRETURN rc;
 
@@ -138,6 +211,24 @@ odbc_session_backend::odbc_session_backend(
 
     connection_string_.assign((const char*)outConnString, strLength);
 
+    std::string cacheSizeString;
+    if (parameters.get_option(odbc_option_statement_cache, cacheSizeString))
+    {
+        int size = 0;
+        std::istringstream converter(cacheSizeString);
+        converter >> size;
+        if (!converter || size < 0)
+        {
+            throw soci_error("Invalid statement cache size \"" +
+                             cacheSizeString + "\".");
+        }
+
+        // Silently don't cache anything if the driver can't keep the
+        // statements prepared, this option is just an optimization.
+        if (!transactions_delete_prepared_statements(hdbc_))
+            statementCacheSize_ = static_cast<std::size_t>(size);
+    }
+
     reset_transaction();
 
     configure_connection();
@@ -410,6 +501,9 @@ void odbc_session_backend::reset_transaction()
 
 void odbc_session_backend::clean_up()
 {
+    // All statement handles must be freed before disconnecting.
+    clear_statement_cache();
+
     SQLRETURN rc = SQLDisconnect(hdbc_);
     if (is_odbc_error(rc))
     {
@@ -429,6 +523,112 @@ void odbc_session_backend::clean_up()
     }
 }
 
+SQLHSTMT odbc_session_backend::acquire_statement()
+{
+    if (!freeStatements_.empty())
+    {
+        SQLHSTMT const hstmt = freeStatements_.back();
+        freeStatements_.pop_back();
+        return hstmt;
+    }
+
+    SQLHSTMT hstmt;
+    SQLRETURN rc = SQLAllocHandle(SQL_HANDLE_STMT, hdbc_, &hstmt);
+    if (is_odbc_error(rc))
+    {
+        throw odbc_soci_error(SQL_HANDLE_DBC, hdbc_, "allocating statement");
+    }
+
+    return hstmt;
+}
+
+SQLHSTMT odbc_session_backend::get_cached_statement(std::string const & query)
+{
+    std::map<std::string, statement_cache_list::iterator>::iterator const
+        it = statementCacheIndex_.find(query);
+    if (it == statementCacheIndex_.end())
+        return NULL;
+
+    SQLHSTMT const hstmt = it->second->second;
+    statementCache_.erase(it->second);
+    statementCacheIndex_.erase(it);
+
+    return hstmt;
+}
+
+void odbc_session_backend::release_statement(std::string const & query,
+                                             SQLHSTMT hstmt)
+{
+    if (!reset_statement(hstmt))
+    {
+        SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+        return;
+    }
+
+    if (query.empty() || statementCacheSize_ == 0)
+    {
+        add_free_statement(hstmt);
+        return;
+    }
+
+    if (is_schema_changing_query(query))
+    {
+        add_free_statement(hstmt);
+        forget_prepared_statements();
+        return;
+    }
+
+    // If another handle for the same query is already cached, just keep
+    // that one.
+    if (statementCacheIndex_.count(query))
+    {
+        add_free_statement(hstmt);
+        return;
+    }
+
+    statementCache_.push_front(std::make_pair(query, hstmt));
+    statementCacheIndex_[query] = statementCache_.begin();
+
+    if (statementCache_.size() > statementCacheSize_)
+    {
+        add_free_statement(statementCache_.back().second);
+        statementCacheIndex_.erase(statementCache_.back().first);
+        statementCache_.pop_back();
+    }
+}
+
+void odbc_session_backend::add_free_statement(SQLHSTMT hstmt)
+{
+    // The handle still being prepared for some query doesn't matter, it will
+    // be prepared again before being used.
+    if (freeStatements_.size() < odbc_max_free_statements)
+        freeStatements_.push_back(hstmt);
+    else
+        SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+}
+
+void odbc_session_backend::forget_prepared_statements()
+{
+    for (statement_cache_list::iterator it = statementCache_.begin();
+         it != statementCache_.end(); ++it)
+    {
+        add_free_statement(it->second);
+    }
+    statementCache_.clear();
+    statementCacheIndex_.clear();
+}
+
+void odbc_session_backend::clear_statement_cache()
+{
+    forget_prepared_statements();
+
+    for (std::size_t i = 0; i != freeStatements_.size(); ++i)
+    {
+        SQLFreeHandle(SQL_HANDLE_STMT, freeStatements_[i]);
+    }
+    freeStatements_.clear();
+}
+
 odbc_statement_backend * odbc_session_backend::make_statement_backend()
 {
     return new odbc_statement_backend(*this);
@@ -479,3 +679,21 @@ odbc_session_backend::get_database_product() const
 
     return product_;
 }
+
+SQLUINTEGER odbc_session_backend::get_data_extensions() const
+{
+    if (dataExtensionsKnown_)
+        return dataExtensions_;
+
+    SQLRETURN rc = SQLGetInfo(hdbc_, SQL_GETDATA_EXTENSIONS,
+                              &dataExtensions_, sizeof(dataExtensions_), NULL);
+    if (is_odbc_error(rc))
+    {
+        // Assume the minimal level of support if we can't determine it.
+        dataExtensions_ = 0;
+    }
+
+    dataExtensionsKnown_ = true;
+
+    return dataExtensions_;
+}
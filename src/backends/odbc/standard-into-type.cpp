@@ -26,6 +26,7 @@ void odbc_standard_into_type_backend::define_by_pos(
     position_ = position++;
 
     SQLUINTEGER size = 0;
+    bool isLongColumn = false;
     switch (type_)
     {
     case x_char:
@@ -40,12 +41,14 @@ void odbc_standard_into_type_backend::define_by_pos(
         odbcType_ = SQL_C_CHAR;
         // For LONGVARCHAR fields the returned size is ODBC_MAX_COL_SIZE
         // (or 0 for some backends), but this doesn't correspond to the actual
-        // field size, which can be (much) greater. For now we just used
-        // a buffer of huge (100MiB) hardcoded size, which is clearly not
-        // ideal, but changing this would require using SQLGetData() and is
-        // not trivial, so for now we're stuck with this suboptimal solution.
+        // field size, which can be (much) greater, so we don't bind such
+        // columns at all and retrieve their values in chunks in post_fetch().
         size = static_cast<SQLUINTEGER>(statement_.column_size(position_));
-        size = (size >= ODBC_MAX_COL_SIZE || size == 0) ? odbc_max_buffer_length : size;
+        if (size >= ODBC_MAX_COL_SIZE || size == 0)
+        {
+            isLongColumn = true;
+            break;
+        }
         size++;
         buf_ = new char[size];
         data = buf_;
@@ -122,6 +125,13 @@ void odbc_standard_into_type_backend::define_by_pos(
 
     valueLen_ = 0;
 
+    lateBound_ = statement_.use_late_binding(position_, isLongColumn);
+    if (lateBound_)
+    {
+        dataSize_ = size;
+        return;
+    }
+
     SQLRETURN rc = SQLBindCol(statement_.hstmt_, static_cast<SQLUSMALLINT>(position_),
         static_cast<SQLUSMALLINT>(odbcType_), data, size, &valueLen_);
     if (is_odbc_error(rc))
@@ -149,6 +159,11 @@ void odbc_standard_into_type_backend::post_fetch(
 
     if (gotData)
     {
+        if (lateBound_)
+        {
+            get_late_bound_value();
+        }
+
         // first, deal with indicators
         if (SQL_NULL_DATA == get_sqllen_from_value(valueLen_))
         {
@@ -174,14 +189,14 @@ void odbc_standard_into_type_backend::post_fetch(
         {
             exchange_type_cast<x_char>(data_) = buf_[0];
         }
+        else if (!buf_)
+        {
+            // Either the value is stored directly in data_ or it's a late
+            // bound string which has been already retrieved.
+        }
         else if (type_ == x_stdstring)
         {
-            std::string& s = exchange_type_cast<x_stdstring>(data_);
-            s = buf_;
-            if (s.size() >= (odbc_max_buffer_length - 1))
-            {
-                throw soci_error("Buffer size overflow; maybe got too large string");
-            }
+            exchange_type_cast<x_stdstring>(data_) = buf_;
         }
         else if (type_ == x_longstring)
         {
@@ -227,8 +242,115 @@ void odbc_standard_into_type_backend::post_fetch(
     }
 }
 
+void odbc_standard_into_type_backend::get_late_bound_value()
+{
+    SQLUSMALLINT const pos = static_cast<SQLUSMALLINT>(position_);
+
+    switch (type_)
+    {
+    case x_stdstring:
+        valueLen_ = get_long_data(pos, exchange_type_cast<x_stdstring>(data_));
+        return;
+    case x_longstring:
+        valueLen_ = get_long_data(pos, exchange_type_cast<x_longstring>(data_).value);
+        return;
+    case x_xmltype:
+        valueLen_ = get_long_data(pos, exchange_type_cast<x_xmltype>(data_).value);
+        return;
+    default:
+        break;
+    }
+
+    valueLen_ = 0;
+    SQLRETURN rc = SQLGetData(statement_.hstmt_, pos, odbcType_,
+                              buf_ ? buf_ : data_, dataSize_, &valueLen_);
+    if (is_odbc_error(rc))
+    {
+        std::ostringstream ss;
+        ss << "getting value of output column #" << position_;
+        throw odbc_soci_error(SQL_HANDLE_STMT, statement_.hstmt_, ss.str());
+    }
+}
+
+SQLLEN odbc_standard_type_backend_base::get_long_data(SQLUSMALLINT colNum,
+                                                      std::string &value)
+{
+    return do_get_long_data(colNum, SQL_C_CHAR, value);
+}
+
+SQLLEN odbc_standard_type_backend_base::get_long_data(SQLUSMALLINT colNum,
+                                                      std::vector<uint8_t> &value)
+{
+    return do_get_long_data(colNum, SQL_C_BINARY, value);
+}
+
+template <typename T>
+SQLLEN odbc_standard_type_backend_base::do_get_long_data(SQLUSMALLINT colNum,
+                                                         SQLSMALLINT cType,
+                                                         T &value)
+{
+    // SQLGetData() always appends a trailing NUL when retrieving SQL_C_CHAR
+    // data, so the buffer must have space for it, but not for SQL_C_BINARY.
+    SQLLEN const nulLen = cType == SQL_C_CHAR ? 1 : 0;
+
+    std::size_t len = 0;
+    value.resize(odbc_long_data_chunk_size);
+
+    for (;;)
+    {
+        SQLLEN const avail = static_cast<SQLLEN>(value.size() - len);
+
+        SQLLEN ind = 0;
+        SQLRETURN rc = SQLGetData(statement_.hstmt_, colNum, cType,
+                                  &value[len], avail, &ind);
+        if (rc == SQL_NO_DATA)
+            break;
+
+        if (is_odbc_error(rc))
+        {
+            std::ostringstream ss;
+            ss << "getting data of column #" << colNum;
+            throw odbc_soci_error(SQL_HANDLE_STMT, statement_.hstmt_, ss.str());
+        }
+
+        ind = get_sqllen_from_value(ind);
+        if (ind == SQL_NULL_DATA)
+        {
+            value.clear();
+            return SQL_NULL_DATA;
+        }
+
+        if (ind != SQL_NO_TOTAL && ind + nulLen <= avail)
+        {
+            // This was the last chunk.
+            len += static_cast<std::size_t>(ind);
+            break;
+        }
+
+        // The data was truncated, so get the remaining part of it into a
+        // bigger buffer, allocating enough space for all of it if we know
+        // how much there is left.
+        len += static_cast<std::size_t>(avail - nulLen);
+
+        std::size_t newSize = 2*value.size();
+        if (ind != SQL_NO_TOTAL)
+            newSize = len + static_cast<std::size_t>(ind - (avail - nulLen) + nulLen);
+
+        value.resize(newSize);
+    }
+
+    value.resize(len);
+
+    return static_cast<SQLLEN>(len);
+}
+
 void odbc_standard_into_type_backend::clean_up()
 {
+    if (lateBound_ && statement_.firstLateBoundColumn_ == position_)
+    {
+        statement_.firstLateBoundColumn_ = 0;
+    }
+
     if (buf_)
     {
         delete [] buf_;
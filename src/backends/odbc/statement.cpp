@@ -8,8 +8,10 @@
 #define SOCI_ODBC_SOURCE
 #include "soci/odbc/soci-odbc.h"
 #include <cctype>
+#include <chrono>
 #include <sstream>
 #include <cstring>
+#include <thread>
 
 using namespace soci;
 using namespace soci::details;
@@ -18,28 +20,47 @@ using namespace soci::details;
 odbc_statement_backend::odbc_statement_backend(odbc_session_backend &session)
     : session_(session), hstmt_(0), numRowsFetched_(0), fetchVectorByRows_(false),
       hasVectorUseElements_(false), boundByName_(false), boundByPos_(false),
-      rowsAffected_(-1LL)
+      rowsAffected_(-1LL), firstLateBoundColumn_(0),
+      structInto_(NULL), structUse_(NULL),
+      structIntoPosition_(0), structUsePosition_(0), prepared_(false),
+      rowsProcessed_(0), asyncEnabled_(false), asyncExecuting_(false)
 {
 }
 
 void odbc_statement_backend::alloc()
 {
-    SQLRETURN rc;
-
-    // Allocate environment handle
-    rc = SQLAllocHandle(SQL_HANDLE_STMT, session_.hdbc_, &hstmt_);
-    if (is_odbc_error(rc))
-    {
-        throw odbc_soci_error(SQL_HANDLE_DBC, session_.hdbc_,
-                              "allocating statement");
-    }
+    hstmt_ = session_.acquire_statement();
 }
 
 void odbc_statement_backend::clean_up()
 {
     rowsAffected_ = -1LL;
 
-    SQLFreeHandle(SQL_HANDLE_STMT, hstmt_);
+    if (hstmt_)
+    {
+        // Cancel the asynchronous execution, if any, and wait until it is
+        // really over, as the handle can't be used until then.
+        if (asyncExecuting_)
+        {
+            SQLCancel(hstmt_);
+            while (SQLExecute(hstmt_) == SQL_STILL_EXECUTING)
+            {
+                // Don't monopolize the CPU while the driver is cancelling.
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+
+            asyncExecuting_ = false;
+        }
+
+        disable_async();
+
+        // Give the handle back to the session for reuse, together with the
+        // query it is prepared for, if any.
+        session_.release_statement(prepared_ ? query_ : std::string(), hstmt_);
+        hstmt_ = 0;
+    }
+
+    prepared_ = false;
 }
 
 
@@ -124,14 +145,26 @@ void odbc_statement_backend::prepare(std::string const & query,
         query_ += "?";
     }
 
-    SQLRETURN rc = SQLPrepare(hstmt_, sqlchar_cast(query_), (SQLINTEGER)query_.size());
-    if (is_odbc_error(rc))
+    // Use the handle already prepared for the same query if we have one.
+    SQLHSTMT const hstmtCached = session_.get_cached_statement(query_);
+    if (hstmtCached)
     {
-        std::ostringstream ss;
-        ss << "preparing query \"" << query_ << "\"";
-        throw odbc_soci_error(SQL_HANDLE_STMT, hstmt_, ss.str());
+        session_.release_statement(std::string(), hstmt_);
+        hstmt_ = hstmtCached;
+    }
+    else
+    {
+        SQLRETURN rc = SQLPrepare(hstmt_, sqlchar_cast(query_), (SQLINTEGER)query_.size());
+        if (is_odbc_error(rc))
+        {
+            std::ostringstream ss;
+            ss << "preparing query \"" << query_ << "\"";
+            throw odbc_soci_error(SQL_HANDLE_STMT, hstmt_, ss.str());
+        }
     }
 
+    prepared_ = true;
+
     // reset any old into buffers, they will be added later if they're used
     // with this query
     intos_.clear();
@@ -140,18 +173,57 @@ void odbc_statement_backend::prepare(std::string const & query,
 statement_backend::exec_fetch_result
 odbc_statement_backend::execute(int number)
 {
-    // Store the number of rows processed by this call.
-    SQLULEN rows_processed = 0;
-    if (hasVectorUseElements_)
+    return do_execute(number, false);
+}
+
+statement_backend::exec_fetch_result
+odbc_statement_backend::execute_async(int number)
+{
+    return do_execute(number, true);
+}
+
+statement_backend::exec_fetch_result
+odbc_statement_backend::do_execute(int number, bool async)
+{
+    // Don't do anything again if we're just checking whether the previously
+    // started asynchronous execution has completed.
+    if (!asyncExecuting_)
     {
-        SQLSetStmtAttr(hstmt_, SQL_ATTR_PARAMS_PROCESSED_PTR, &rows_processed, 0);
-    }
+        if (structUse_)
+        {
+            bind_struct_parameters();
+        }
+
+        // Store the number of rows processed by this call.
+        rowsProcessed_ = 0;
+        if (hasVectorUseElements_)
+        {
+            SQLSetStmtAttr(hstmt_, SQL_ATTR_PARAMS_PROCESSED_PTR, &rowsProcessed_, 0);
+        }
 
-    // if we are called twice for the same statement we need to close the open
-    // cursor or an "invalid cursor state" error will occur on execute
-    SQLCloseCursor(hstmt_);
+        // if we are called twice for the same statement we need to close the open
+        // cursor or an "invalid cursor state" error will occur on execute
+        SQLCloseCursor(hstmt_);
+
+        // If the driver doesn't support asynchronous execution, just execute
+        // the statement synchronously.
+        if (async)
+        {
+            asyncEnabled_ = !is_odbc_error(
+                SQLSetStmtAttr(hstmt_, SQL_ATTR_ASYNC_ENABLE,
+                               (SQLPOINTER)SQL_ASYNC_ENABLE_ON, 0));
+        }
+    }
 
     SQLRETURN rc = SQLExecute(hstmt_);
+    if (rc == SQL_STILL_EXECUTING)
+    {
+        asyncExecuting_ = true;
+        return ef_still_executing;
+    }
+
+    asyncExecuting_ = false;
+
     if (is_odbc_error(rc))
     {
         // Construct the error object immediately, before calling any other
@@ -179,17 +251,24 @@ odbc_statement_backend::execute(int number)
                   else
                     rowsAffected_ += res;
                 }
-                --rows_processed; // Avoid unnecessary calls to SQLGetDiagField
+                --rowsProcessed_; // Avoid unnecessary calls to SQLGetDiagField
             }
             // Move forward to the next result while there are rows processed.
-            while (rows_processed > 0 && SQLMoreResults(hstmt_) == SQL_SUCCESS);
+            while (rowsProcessed_ > 0 && SQLMoreResults(hstmt_) == SQL_SUCCESS);
         }
+
+        disable_async();
+
         throw err;
     }
-    else if (hasVectorUseElements_)
+
+    // Everything else, including fetching the data, is done synchronously.
+    disable_async();
+
+    if (hasVectorUseElements_)
     {
         // We already have the number of rows, no need to do anything.
-        rowsAffected_ = rows_processed;
+        rowsAffected_ = rowsProcessed_;
     }
     else // We need to retrieve the number of rows affected explicitly.
     {
@@ -214,6 +293,16 @@ odbc_statement_backend::execute(int number)
     return ef_success;
 }
 
+void odbc_statement_backend::disable_async()
+{
+    if (asyncEnabled_)
+    {
+        SQLSetStmtAttr(hstmt_, SQL_ATTR_ASYNC_ENABLE,
+                       (SQLPOINTER)SQL_ASYNC_ENABLE_OFF, 0);
+        asyncEnabled_ = false;
+    }
+}
+
 statement_backend::exec_fetch_result
 odbc_statement_backend::do_fetch(int beginRow, int endRow)
 {
@@ -229,6 +318,34 @@ odbc_statement_backend::do_fetch(int beginRow, int endRow)
         throw odbc_soci_error(SQL_HANDLE_STMT, hstmt_, "fetching data");
     }
 
+    if (firstLateBoundColumn_ != 0)
+    {
+        // When fetching more than one row at once, we need to position the
+        // cursor on each of them before retrieving the late bound values.
+        SQLULEN const rows = fetchVectorByRows_ ? 1 : numRowsFetched_;
+        for (SQLULEN i = 0; i != rows; ++i)
+        {
+            if (endRow - beginRow > 1)
+            {
+                rc = SQLSetPos(hstmt_, static_cast<SQLSETPOSIROW>(i + 1),
+                               SQL_POSITION, SQL_LOCK_NO_CHANGE);
+                if (is_odbc_error(rc))
+                {
+                    throw odbc_soci_error(SQL_HANDLE_STMT, hstmt_,
+                                          "positioning on the fetched row");
+                }
+            }
+
+            for (std::size_t j = 0; j != intos_.size(); ++j)
+            {
+                if (intos_[j]->lateBound_)
+                {
+                    intos_[j]->get_late_bound_value(beginRow + i, i);
+                }
+            }
+        }
+    }
+
     for (std::size_t j = 0; j != intos_.size(); ++j)
     {
         intos_[j]->do_post_fetch_rows(beginRow, endRow);
@@ -242,6 +359,28 @@ odbc_statement_backend::fetch(int number)
 {
     numRowsFetched_ = 0;
 
+    if (structInto_)
+    {
+        if (!intos_.empty())
+        {
+            throw soci_error("Row-wise binding of structs can't be combined "
+                             "with other vector into elements.");
+        }
+
+        bind_struct_columns(static_cast<SQLULEN>(number));
+
+        SQLULEN row_array_size = static_cast<SQLULEN>(number);
+        SQLSetStmtAttr(hstmt_, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)row_array_size, 0);
+
+        SQLSetStmtAttr(hstmt_, SQL_ATTR_ROWS_FETCHED_PTR, &numRowsFetched_, 0);
+
+        statement_backend::exec_fetch_result const res = do_fetch(0, number);
+
+        fix_struct_indicators();
+
+        return res;
+    }
+
     for (std::size_t i = 0; i != intos_.size(); ++i)
     {
         intos_[i]->resize(number);
@@ -252,10 +391,9 @@ odbc_statement_backend::fetch(int number)
     statement_backend::exec_fetch_result res SOCI_DUMMY_INIT(ef_success);
 
     // Usually we try to fetch the entire vector at once, but if some into
-    // string columns are bigger than 8KB (ODBC_MAX_COL_SIZE) then we use
-    // 100MB buffer for that columns. So in this case we downgrade to using
-    // scalar fetches to hold the buffer only for a single row and not
-    // rows_count * 100MB.
+    // columns are late bound and the driver doesn't support using
+    // SQLGetData() with multirow cursors, we have to fetch the rows one by
+    // one.
     // See odbc_vector_into_type_backend::define_by_pos().
     if (!fetchVectorByRows_)
     {
@@ -268,6 +406,8 @@ odbc_statement_backend::fetch(int number)
     }
     else // Use multiple calls to SQLFetch().
     {
+        SQLSetStmtAttr(hstmt_, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)1, 0);
+
         SQLULEN curNumRowsFetched = 0;
         SQLSetStmtAttr(hstmt_, SQL_ATTR_ROWS_FETCHED_PTR, &curNumRowsFetched, 0);
 
@@ -435,6 +575,239 @@ std::size_t odbc_statement_backend::column_size(int colNum)
     return colSize;
 }
 
+bool odbc_statement_backend::use_late_binding(int colNum, bool isLongColumn)
+{
+    if (isLongColumn)
+    {
+        if (firstLateBoundColumn_ == 0 || colNum < firstLateBoundColumn_)
+            firstLateBoundColumn_ = colNum;
+
+        return true;
+    }
+
+    // Unless the driver supports SQL_GD_ANY_COLUMN extension, SQLGetData()
+    // can only be used for the columns following the last bound one, so all
+    // the columns after the first late bound one must be late bound too.
+    return firstLateBoundColumn_ != 0 && colNum > firstLateBoundColumn_ &&
+            !(session_.get_data_extensions() & SQL_GD_ANY_COLUMN);
+}
+
+void odbc_statement_backend::define_struct_by_pos(int &position,
+                                                  struct_vector_base &v)
+{
+    if (structInto_)
+    {
+        throw soci_error("Only a single vector of structs can be used for "
+                         "the into elements.");
+    }
+
+    structInto_ = &v;
+    structIntoPosition_ = position;
+    position += static_cast<int>(v.fields().size());
+}
+
+void odbc_statement_backend::bind_struct_by_pos(int &position,
+                                                struct_vector_base &v)
+{
+    if (boundByName_)
+    {
+        throw soci_error(
+         "Binding for use elements must be either by position or by name.");
+    }
+
+    if (structUse_)
+    {
+        throw soci_error("Only a single vector of structs can be used for "
+                         "the use elements.");
+    }
+
+    structUse_ = &v;
+    structUsePosition_ = position;
+    position += static_cast<int>(v.fields().size());
+
+    boundByPos_ = true;
+    hasVectorUseElements_ = true;
+}
+
+void odbc_statement_backend::clean_up_struct(struct_vector_base &v)
+{
+    if (structInto_ == &v)
+        structInto_ = NULL;
+    if (structUse_ == &v)
+        structUse_ = NULL;
+}
+
+void odbc_statement_backend::get_struct_field_types(struct_field const &field,
+    SQLSMALLINT &cType, SQLSMALLINT &sqlType) const
+{
+    // Use the same SQL types as for the individual use elements, see
+    // supports_negative_tinyint() and can_convert_to_unsigned_sql_type() in
+    // odbc_standard_type_backend_base.
+    bool const isMSSQL
+        = session_.get_database_product() == odbc_session_backend::prod_mssql;
+
+    switch (field.type_)
+    {
+    case x_char:
+        cType = SQL_C_CHAR;
+        sqlType = SQL_VARCHAR;
+        break;
+    case x_int8:
+        cType = SQL_C_STINYINT;
+        sqlType = isMSSQL ? SQL_SMALLINT : SQL_TINYINT;
+        break;
+    case x_uint8:
+        cType = SQL_C_UTINYINT;
+        sqlType = isMSSQL ? SQL_SMALLINT : SQL_TINYINT;
+        break;
+    case x_int16:
+        cType = SQL_C_SSHORT;
+        sqlType = SQL_SMALLINT;
+        break;
+    case x_uint16:
+        cType = SQL_C_USHORT;
+        sqlType = isMSSQL ? SQL_INTEGER : SQL_SMALLINT;
+        break;
+    case x_int32:
+        cType = SQL_C_SLONG;
+        sqlType = SQL_INTEGER;
+        break;
+    case x_uint32:
+        cType = SQL_C_ULONG;
+        sqlType = isMSSQL ? SQL_BIGINT : SQL_INTEGER;
+        break;
+    case x_int64:
+    case x_uint64:
+        // We can't use the workaround for the drivers not supporting 64 bit
+        // integers here, as it requires converting the values to strings.
+        if (session_.get_database_product() == odbc_session_backend::prod_oracle)
+        {
+            throw soci_error("64-bit integer struct fields are not supported "
+                             "with this ODBC driver.");
+        }
+
+        cType = field.type_ == x_int64 ? SQL_C_SBIGINT : SQL_C_UBIGINT;
+        sqlType = SQL_BIGINT;
+        break;
+    case x_double:
+        cType = SQL_C_DOUBLE;
+        sqlType = SQL_DOUBLE;
+        break;
+    default:
+        throw soci_error("Struct field of non-supported type.");
+    }
+
+    if (field.indOffset_ != -1 && field.indSize_ != sizeof(SQLLEN))
+    {
+        throw soci_error("Struct field indicator must be of SQLLEN type.");
+    }
+}
+
+void odbc_statement_backend::bind_struct_columns(SQLULEN rows)
+{
+    // Make sure the vector has enough space for all the rows before getting
+    // the pointer to its data, as it could be reallocated when resizing it.
+    structInto_->vector_resize(rows);
+    char * const data = static_cast<char *>(structInto_->vector_data());
+
+    SQLULEN const elementSize = structInto_->element_size();
+    SQLSetStmtAttr(hstmt_, SQL_ATTR_ROW_BIND_TYPE, (SQLPOINTER)elementSize, 0);
+
+    std::vector<struct_field> const &fields = structInto_->fields();
+    for (std::size_t i = 0; i != fields.size(); ++i)
+    {
+        struct_field const &f = fields[i];
+
+        SQLSMALLINT cType, sqlType;
+        get_struct_field_types(f, cType, sqlType);
+
+        SQLLEN * const ind = f.indOffset_ == -1
+            ? NULL
+            : reinterpret_cast<SQLLEN *>(data + f.indOffset_);
+
+        SQLUSMALLINT const pos
+            = static_cast<SQLUSMALLINT>(structIntoPosition_ + static_cast<int>(i));
+        SQLRETURN rc = SQLBindCol(hstmt_, pos, cType, data + f.offset_,
+                                  static_cast<SQLLEN>(f.size_), ind);
+        if (is_odbc_error(rc))
+        {
+            std::ostringstream ss;
+            ss << "binding struct field #" << i + 1 << " to column #" << pos;
+            throw odbc_soci_error(SQL_HANDLE_STMT, hstmt_, ss.str());
+        }
+    }
+}
+
+void odbc_statement_backend::fix_struct_indicators()
+{
+    // IBM DB2 driver only fills the lower 32 bits of the indicators in 64 bit
+    // builds, see odbc_standard_type_backend_base::get_sqllen_from_value().
+    if (sizeof(SQLLEN) == sizeof(int) ||
+            session_.get_database_product() != odbc_session_backend::prod_db2)
+        return;
+
+    char * const data = static_cast<char *>(structInto_->vector_data());
+    std::size_t const elementSize = structInto_->element_size();
+
+    std::vector<struct_field> const &fields = structInto_->fields();
+    for (SQLULEN row = 0; row != numRowsFetched_; ++row)
+    {
+        for (std::size_t i = 0; i != fields.size(); ++i)
+        {
+            if (fields[i].indOffset_ == -1)
+                continue;
+
+            char * const ind = data + row * elementSize + fields[i].indOffset_;
+
+            int value;
+            std::memcpy(&value, ind, sizeof(value));
+
+            SQLLEN const len = value;
+            std::memcpy(ind, &len, sizeof(len));
+        }
+    }
+}
+
+void odbc_statement_backend::bind_struct_parameters()
+{
+    char * const data = static_cast<char *>(structUse_->vector_data());
+
+    SQLULEN const elementSize = structUse_->element_size();
+    SQLSetStmtAttr(hstmt_, SQL_ATTR_PARAM_BIND_TYPE, (SQLPOINTER)elementSize, 0);
+
+    SQLULEN const arraySize = static_cast<SQLULEN>(structUse_->vector_size());
+    SQLSetStmtAttr(hstmt_, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER)arraySize, 0);
+
+    std::vector<struct_field> const &fields = structUse_->fields();
+    for (std::size_t i = 0; i != fields.size(); ++i)
+    {
+        struct_field const &f = fields[i];
+
+        SQLSMALLINT cType, sqlType;
+        get_struct_field_types(f, cType, sqlType);
+
+        // Without the indicator, the strings must be NUL-terminated.
+        SQLLEN * const ind = f.indOffset_ == -1
+            ? NULL
+            : reinterpret_cast<SQLLEN *>(data + f.indOffset_);
+
+        SQLULEN const columnSize = f.type_ == x_char ? f.size_ - 1 : f.size_;
+
+        SQLUSMALLINT const pos
+            = static_cast<SQLUSMALLINT>(structUsePosition_ + static_cast<int>(i));
+        SQLRETURN rc = SQLBindParameter(hstmt_, pos, SQL_PARAM_INPUT,
+                                        cType, sqlType, columnSize, 0,
+                                        data + f.offset_,
+                                        static_cast<SQLLEN>(f.size_), ind);
+        if (is_odbc_error(rc))
+        {
+            std::ostringstream ss;
+            ss << "binding struct field #" << i + 1 << " to parameter #" << pos;
+            throw odbc_soci_error(SQL_HANDLE_STMT, hstmt_, ss.str());
+        }
+    }
+}
+
 odbc_standard_into_type_backend * odbc_statement_backend::make_into_type_backend()
 {
     return new odbc_standard_into_type_backend(*this);
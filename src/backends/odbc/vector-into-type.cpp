@@ -41,6 +41,7 @@ void odbc_vector_into_type_backend::define_by_pos(
 
     indHolderVec_.resize(vectorSize);
 
+    bool isLongColumn = false;
     switch (type)
     {
     // simple cases
@@ -108,13 +109,11 @@ void odbc_vector_into_type_backend::define_by_pos(
             colSize_ = static_cast<size_t>(get_sqllen_from_value(statement_.column_size(position)));
             if (colSize_ >= ODBC_MAX_COL_SIZE || colSize_ == 0)
             {
-                // Column size for text data type can be too large for buffer allocation.
-                colSize_ = odbc_max_buffer_length;
-                // If we are using huge buffer size then we need to fetch rows
-                // one by one as otherwise we could easily run out of memory.
-                // Note that the flag is permanent for the statement and will
-                // never be reset.
-                statement_.fetchVectorByRows_ = true;
+                // Column size for text data type can be too large for buffer
+                // allocation, so don't bind this column at all and retrieve
+                // its values directly into the vector elements instead.
+                isLongColumn = true;
+                break;
             }
 
             colSize_++;
@@ -126,6 +125,24 @@ void odbc_vector_into_type_backend::define_by_pos(
             buf_ = new char[colSize_ * elementsCount];
         }
         break;
+    case x_binary:
+        {
+            odbcType_ = SQL_C_BINARY;
+
+            // Binary values are handled in the same way as strings, except
+            // that they don't need space for the trailing NUL.
+            colSize_ = static_cast<size_t>(get_sqllen_from_value(statement_.column_size(position)));
+            if (colSize_ >= ODBC_MAX_COL_SIZE || colSize_ == 0)
+            {
+                isLongColumn = true;
+                break;
+            }
+
+            const std::size_t elementsCount
+                = statement_.fetchVectorByRows_ ? 1 : vectorSize;
+            buf_ = new char[colSize_ * elementsCount];
+        }
+        break;
     case x_stdtm:
         odbcType_ = SQL_C_TYPE_TIMESTAMP;
 
@@ -139,13 +156,28 @@ void odbc_vector_into_type_backend::define_by_pos(
 
     position++;
 
+    lateBound_ = statement_.use_late_binding(position_ + 1, isLongColumn);
+    if (lateBound_)
+    {
+        // SQLGetData() can only be used with multirow cursors if the driver
+        // supports it, otherwise we have to fetch the rows one by one. Note
+        // that the flag is permanent for the statement and will never be
+        // reset.
+        if (!(statement_.session_.get_data_extensions() & SQL_GD_BLOCK))
+        {
+            statement_.fetchVectorByRows_ = true;
+        }
+
+        return;
+    }
+
     rebind_row(0);
 }
 
-void odbc_vector_into_type_backend::rebind_row(std::size_t rowInd)
+void* odbc_vector_into_type_backend::get_element_ptr(std::size_t rowInd,
+                                                     SQLLEN &size)
 {
     void* elementPtr = NULL;
-    SQLLEN size = 0;
     switch (type_)
     {
     // simple cases
@@ -198,6 +230,7 @@ void odbc_vector_into_type_backend::rebind_row(std::size_t rowInd)
     case x_stdstring:
     case x_xmltype:
     case x_longstring:
+    case x_binary:
     case x_stdtm:
         // Do nothing.
         break;
@@ -206,6 +239,19 @@ void odbc_vector_into_type_backend::rebind_row(std::size_t rowInd)
         throw soci_error("Into element used with non-supported type.");
     }
 
+    return elementPtr;
+}
+
+void odbc_vector_into_type_backend::rebind_row(std::size_t rowInd)
+{
+    if (lateBound_)
+    {
+        // Nothing to rebind, the values are retrieved after fetching.
+        return;
+    }
+
+    SQLLEN size = 0;
+    void* elementPtr = get_element_ptr(rowInd, size);
     if (elementPtr == NULL)
     {
         // It's one of the types for which we use fixed buffer.
@@ -226,6 +272,47 @@ void odbc_vector_into_type_backend::rebind_row(std::size_t rowInd)
     }
 }
 
+void odbc_vector_into_type_backend::get_late_bound_value(std::size_t rowInd,
+                                                         std::size_t bufInd)
+{
+    const SQLUSMALLINT pos = static_cast<SQLUSMALLINT>(position_ + 1);
+
+    if (type_ == x_stdstring || type_ == x_xmltype || type_ == x_longstring)
+    {
+        set_sqllen_to_vector_at(rowInd,
+            get_long_data(pos, vector_string_value(type_, data_, rowInd)));
+        return;
+    }
+
+    if (type_ == x_binary)
+    {
+        set_sqllen_to_vector_at(rowInd,
+            get_long_data(pos, exchange_vector_type_cast<x_binary>(data_)[rowInd]));
+        return;
+    }
+
+    SQLLEN size = 0;
+    void* elementPtr = get_element_ptr(rowInd, size);
+    if (elementPtr == NULL)
+    {
+        elementPtr = buf_ + bufInd * colSize_;
+        size = colSize_;
+    }
+
+    SQLLEN len = 0;
+    SQLRETURN rc = SQLGetData(statement_.hstmt_, pos, odbcType_,
+                              elementPtr, size, &len);
+    if (is_odbc_error(rc))
+    {
+        std::ostringstream ss;
+        ss << "getting output vector item at index " << rowInd
+           << " of column #" << pos;
+        throw odbc_soci_error(SQL_HANDLE_STMT, statement_.hstmt_, ss.str());
+    }
+
+    set_sqllen_to_vector_at(rowInd, get_sqllen_from_value(len));
+}
+
 void odbc_vector_into_type_backend::pre_fetch()
 {
     // nothing to do for the supported types
@@ -247,7 +334,9 @@ void odbc_vector_into_type_backend::do_post_fetch_rows(
             pos += colSize_;
         }
     }
-    if (type_ == x_stdstring || type_ == x_xmltype || type_ == x_longstring)
+    // Note that late bound strings have been already stored in the vector.
+    if ((type_ == x_stdstring || type_ == x_xmltype || type_ == x_longstring)
+            && !lateBound_)
     {
         const char *pos = buf_;
         for (std::size_t i = beginRow; i != endRow; ++i, pos += colSize_)
@@ -287,6 +376,28 @@ void odbc_vector_into_type_backend::do_post_fetch_rows(
             value.assign(pos, end - pos);
         }
     }
+    else if (type_ == x_binary && !lateBound_)
+    {
+        std::vector<std::vector<uint8_t> > &v
+            = exchange_vector_type_cast<x_binary>(data_);
+
+        const char *pos = buf_;
+        for (std::size_t i = beginRow; i != endRow; ++i, pos += colSize_)
+        {
+            SQLLEN const len = get_sqllen_from_vector_at(i);
+            if (len == -1)
+            {
+                v[i].clear();
+                continue;
+            }
+
+            // Unlike strings, binary values are never padded, but they may be
+            // truncated if the driver reported a too small column size.
+            const std::size_t size
+                = std::min(static_cast<std::size_t>(len), colSize_);
+            v[i].assign(pos, pos + size);
+        }
+    }
     else if (type_ == x_stdtm)
     {
         std::vector<std::tm> *vp
@@ -383,6 +494,11 @@ std::size_t odbc_vector_into_type_backend::size()
 
 void odbc_vector_into_type_backend::clean_up()
 {
+    if (lateBound_ && statement_.firstLateBoundColumn_ == position_ + 1)
+    {
+        statement_.firstLateBoundColumn_ = 0;
+    }
+
     if (buf_ != NULL)
     {
         delete [] buf_;
@@ -231,6 +231,42 @@ void* odbc_vector_use_type_backend::prepare_for_bind(SQLUINTEGER &size,
             cType = SQL_C_CHAR;
         }
         break;
+    case x_binary:
+        {
+            std::vector<std::vector<uint8_t> > &v
+                = exchange_vector_type_cast<x_binary>(data_);
+
+            std::size_t maxSize = 0;
+            std::size_t const vecSize = v.size();
+            prepare_indicators(vecSize);
+            for (std::size_t i = 0; i != vecSize; ++i)
+            {
+                std::size_t sz = v[i].size();
+                set_sqllen_from_vector_at(i, static_cast<long>(sz));
+                maxSize = sz > maxSize ? sz : maxSize;
+            }
+
+            // The buffer can't be empty even if all values are.
+            if (maxSize == 0)
+                maxSize = 1;
+
+            buf_ = new char[maxSize * vecSize];
+
+            char *pos = buf_;
+            for (std::size_t i = 0; i != vecSize; ++i)
+            {
+                if (!v[i].empty())
+                    memcpy(pos, &v[i][0], v[i].size());
+                pos += maxSize;
+            }
+
+            data = buf_;
+            size = static_cast<SQLINTEGER>(maxSize);
+
+            sqlType = size >= ODBC_MAX_COL_SIZE ? SQL_LONGVARBINARY : SQL_VARBINARY;
+            cType = SQL_C_BINARY;
+        }
+        break;
     case x_stdtm:
         {
             std::vector<std::tm> *vp
@@ -314,6 +350,12 @@ void odbc_vector_use_type_backend::bind_by_name(
 
 void odbc_vector_use_type_backend::pre_use(indicator const *ind)
 {
+    if (statement_.structUse_)
+    {
+        throw soci_error("Row-wise binding of structs can't be combined "
+                         "with other vector use elements.");
+    }
+
     SQLSMALLINT sqlType(0);
     SQLSMALLINT cType(0);
     SQLUINTEGER size(0);
@@ -344,6 +386,10 @@ void odbc_vector_use_type_backend::pre_use(indicator const *ind)
             non_null_indicator = SQL_NTS;
             break;
 
+        case x_binary:
+            // Lengths of the values were set by prepare_for_bind().
+            break;
+
         case x_stdtm:
             {
                 std::vector<std::tm> *vp
@@ -437,8 +483,9 @@ void odbc_vector_use_type_backend::pre_use(indicator const *ind)
             }
             else
             {
-                // for strings we have already set the values
-                if (type_ != x_stdstring && type_ != x_xmltype && type_ != x_longstring)
+                // for strings and binary values we have already set the values
+                if (type_ != x_stdstring && type_ != x_xmltype &&
+                        type_ != x_longstring && type_ != x_binary)
                 {
                     set_sqllen_from_vector_at(i, non_null_indicator);
                 }
@@ -450,8 +497,9 @@ void odbc_vector_use_type_backend::pre_use(indicator const *ind)
         // no indicators - treat all fields as OK
         for (std::size_t i = 0; i != indHolderVec_.size(); ++i)
         {
-            // for strings we have already set the values
-            if (type_ != x_stdstring && type_ != x_xmltype && type_ != x_longstring)
+            // for strings and binary values we have already set the values
+            if (type_ != x_stdstring && type_ != x_xmltype &&
+                    type_ != x_longstring && type_ != x_binary)
             {
                 set_sqllen_from_vector_at(i, non_null_indicator);
             }
@@ -108,8 +108,36 @@ oracle_session_backend * oracle_backend_factory::make_session(
         ncharset = charset_code(value);
     }
 
+    int stmtCacheSize = 0;
+    if (params.get_option("stmt_cache_size", value))
+    {
+        if (!cstring_to_unsigned(stmtCacheSize, value.c_str()))
+        {
+            throw soci_error("Invalid statement cache size.");
+        }
+    }
+
+    int prefetchRows = oracle_default_prefetch_rows;
+    if (params.get_option("prefetch_rows", value))
+    {
+        if (!cstring_to_unsigned(prefetchRows, value.c_str()))
+        {
+            throw soci_error("Invalid number of prefetch rows.");
+        }
+    }
+
+    int prefetchMemory = 0;
+    if (params.get_option("prefetch_memory", value))
+    {
+        if (!cstring_to_unsigned(prefetchMemory, value.c_str()))
+        {
+            throw soci_error("Invalid prefetch memory size.");
+        }
+    }
+
     return new oracle_session_backend(serviceName, userName, password,
-        mode, decimals_as_strings, charset, ncharset);
+        mode, decimals_as_strings, charset, ncharset, stmtCacheSize,
+        prefetchRows, prefetchMemory);
 }
 
 oracle_backend_factory const soci::oracle;
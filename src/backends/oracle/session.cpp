@@ -124,9 +124,13 @@ sb4 fo_callback(void * /* svchp */, void * /* envhp */, void * fo_ctx,
 
 oracle_session_backend::oracle_session_backend(std::string const & serviceName,
     std::string const & userName, std::string const & password, int mode,
-    bool decimals_as_strings, int charset, int ncharset)
+    bool decimals_as_strings, int charset, int ncharset, int stmtCacheSize,
+    int prefetchRows, int prefetchMemory)
     : envhp_(NULL), srvhp_(NULL), errhp_(NULL), svchp_(NULL), usrhp_(NULL),
-      decimals_as_strings_(decimals_as_strings)
+      decimals_as_strings_(decimals_as_strings),
+      stmtCacheSize_(static_cast<ub4>(stmtCacheSize)),
+      prefetchRows_(static_cast<ub4>(prefetchRows)),
+      prefetchMemory_(static_cast<ub4>(prefetchMemory))
 {
     // assume service/user/password are utf8-compatible already
     const int defaultSourceCharSetId = 871;
@@ -364,6 +368,21 @@ oracle_session_backend::oracle_session_backend(std::string const & serviceName,
         clean_up();
         throw oracle_soci_error(msg, errNum);
     }
+
+    // enable the client-side statement cache, if requested
+    if (stmtCacheSize_ != 0)
+    {
+        res = OCIAttrSet(svchp_, OCI_HTYPE_SVCCTX, &stmtCacheSize_,
+            0, OCI_ATTR_STMTCACHESIZE, errhp_);
+        if (res != OCI_SUCCESS)
+        {
+            std::string msg;
+            int errNum;
+            get_error_details(res, errhp_, msg, errNum);
+            clean_up();
+            throw oracle_soci_error(msg, errNum);
+        }
+    }
 }
 
 oracle_session_backend::~oracle_session_backend()
@@ -199,6 +199,9 @@ void oracle_standard_into_type_backend::define_by_pos(
             ociData_ = lobp;
         }
         break;
+
+    case x_binary:
+        throw soci_error("Binary values are only supported in bulk operations.");
     }
 
     sword res = OCIDefineByPos(statement_.stmtp_, &defnp_,
@@ -200,6 +200,9 @@ void oracle_standard_use_type_backend::prepare_for_bind(
             ociData_ = lobp;
         }
         break;
+
+    case x_binary:
+        throw soci_error("Binary values are only supported in bulk operations.");
     }
 }
 
@@ -469,6 +472,7 @@ void oracle_standard_use_type_backend::pre_use(indicator const *ind)
     case x_longstring:
     case x_rowid:
     case x_blob:
+    case x_binary:
         // nothing to do
         break;
     }
@@ -683,6 +687,7 @@ void oracle_standard_use_type_backend::post_use(bool gotData, indicator *ind)
         case x_rowid:
         case x_xmltype:
         case x_longstring:
+        case x_binary:
             // nothing to do here
             break;
         }
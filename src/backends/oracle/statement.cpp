@@ -25,8 +25,11 @@ using namespace soci::details;
 using namespace soci::details::oracle;
 
 oracle_statement_backend::oracle_statement_backend(oracle_session_backend &session)
-    : session_(session), stmtp_(NULL), boundByName_(false), boundByPos_(false),
-      noData_(false)
+    : session_(session), stmtp_(NULL),
+      prefetchRows_(session.get_prefetch_rows()),
+      prefetchMemory_(session.get_prefetch_memory()),
+      boundByName_(false), boundByPos_(false), hasVectorUseElements_(false),
+      noData_(false), fromCache_(false), collectBulkErrors_(false)
 {
 }
 
@@ -41,37 +44,161 @@ void oracle_statement_backend::alloc()
     }
 }
 
-void oracle_statement_backend::clean_up()
+void oracle_statement_backend::free_handle()
 {
-    // deallocate statement handle
     if (stmtp_ != NULL)
     {
-        OCIHandleFree(stmtp_, OCI_HTYPE_STMT);
+        if (fromCache_)
+        {
+            // return the statement to the cache for reuse
+            OCIStmtRelease(stmtp_, session_.errhp_, NULL, 0, OCI_DEFAULT);
+            fromCache_ = false;
+        }
+        else
+        {
+            OCIHandleFree(stmtp_, OCI_HTYPE_STMT);
+        }
+
         stmtp_ = NULL;
     }
+}
+
+void oracle_statement_backend::clean_up()
+{
+    // deallocate statement handle
+    free_handle();
 
     boundByName_ = false;
     boundByPos_ = false;
+    hasVectorUseElements_ = false;
 }
 
 void oracle_statement_backend::prepare(std::string const &query,
     statement_type /* eType */)
 {
-    sb4 stmtLen = static_cast<sb4>(query.size());
-    sword res = OCIStmtPrepare(stmtp_,
-        session_.errhp_,
-        reinterpret_cast<text*>(const_cast<char*>(query.c_str())),
-        stmtLen, OCI_V7_SYNTAX, OCI_DEFAULT);
+    if (session_.get_statement_cache_size() != 0)
+    {
+        // OCIStmtPrepare2() returns its own handle, which is either taken from
+        // the cache, if the same query had been already prepared, or newly
+        // allocated, so get rid of the one created by alloc() or a previous
+        // call to this function.
+        free_handle();
+
+        sword res = OCIStmtPrepare2(session_.svchp_, &stmtp_,
+            session_.errhp_,
+            reinterpret_cast<text const*>(query.c_str()),
+            static_cast<ub4>(query.size()), NULL, 0,
+            OCI_NTV_SYNTAX, OCI_DEFAULT);
+        if (res != OCI_SUCCESS)
+        {
+            std::string msg;
+            int errNum;
+            get_error_details(res, session_.errhp_, msg, errNum);
+
+            // don't keep the statement which couldn't be prepared in the cache
+            if (stmtp_ != NULL)
+            {
+                OCIStmtRelease(stmtp_, session_.errhp_, NULL, 0,
+                    OCI_STRLS_CACHE_DELETE);
+                stmtp_ = NULL;
+            }
+
+            throw oracle_soci_error(msg, errNum);
+        }
+
+        fromCache_ = true;
+    }
+    else
+    {
+        sb4 stmtLen = static_cast<sb4>(query.size());
+        sword res = OCIStmtPrepare(stmtp_,
+            session_.errhp_,
+            reinterpret_cast<text*>(const_cast<char*>(query.c_str())),
+            stmtLen, OCI_V7_SYNTAX, OCI_DEFAULT);
+        if (res != OCI_SUCCESS)
+        {
+            throw_oracle_soci_error(res, session_.errhp_);
+        }
+    }
+
+    // Prefetching allows to avoid a round trip to the server for each call
+    // to OCIStmtFetch() when fetching the rows one by one. Notice that this
+    // must be done even for the cached statements, as they could have been
+    // used with different values before.
+    set_prefetch_attr(OCI_ATTR_PREFETCH_ROWS, prefetchRows_);
+    set_prefetch_attr(OCI_ATTR_PREFETCH_MEMORY, prefetchMemory_);
+}
+
+void oracle_statement_backend::set_prefetch_attr(ub4 attr, ub4 value)
+{
+    sword res = OCIAttrSet(stmtp_, OCI_HTYPE_STMT, &value, 0,
+        attr, session_.errhp_);
     if (res != OCI_SUCCESS)
     {
         throw_oracle_soci_error(res, session_.errhp_);
     }
 }
 
+void oracle_statement_backend::set_prefetch_rows(ub4 rows)
+{
+    prefetchRows_ = rows;
+
+    // If the statement is not prepared yet, this will be done in prepare().
+    if (stmtp_ != NULL)
+    {
+        set_prefetch_attr(OCI_ATTR_PREFETCH_ROWS, prefetchRows_);
+    }
+}
+
+void oracle_statement_backend::set_prefetch_memory(ub4 bytes)
+{
+    prefetchMemory_ = bytes;
+
+    if (stmtp_ != NULL)
+    {
+        set_prefetch_attr(OCI_ATTR_PREFETCH_MEMORY, prefetchMemory_);
+    }
+}
+
 statement_backend::exec_fetch_result oracle_statement_backend::execute(int number)
 {
+    bulkErrors_.clear();
+
+    ub4 mode = OCI_DEFAULT;
+    // Check for the vector use elements and not the number of iterations, as
+    // a bulk operation can consist of a single row too.
+    if (collectBulkErrors_ && hasVectorUseElements_)
+    {
+        // For queries, the number of iterations is the number of rows to
+        // fetch and batch errors mode can't be used.
+        ub2 stmtType = 0;
+        sword res = OCIAttrGet(stmtp_, OCI_HTYPE_STMT, &stmtType, 0,
+            OCI_ATTR_STMT_TYPE, session_.errhp_);
+        if (res != OCI_SUCCESS)
+        {
+            throw_oracle_soci_error(res, session_.errhp_);
+        }
+
+        if (stmtType != OCI_STMT_SELECT)
+        {
+            mode = OCI_BATCH_ERRORS;
+        }
+    }
+
     sword res = OCIStmtExecute(session_.svchp_, stmtp_, session_.errhp_,
-        static_cast<ub4>(number), 0, 0, 0, OCI_DEFAULT);
+        static_cast<ub4>(number), 0, 0, 0, mode);
+
+    if (mode == OCI_BATCH_ERRORS &&
+        (res == OCI_SUCCESS_WITH_INFO || res == OCI_ERROR))
+    {
+        // The failure of some rows is reported as ORA-24381, but any other
+        // error still needs to be reported as usual.
+        read_bulk_errors();
+        if (!bulkErrors_.empty())
+        {
+            res = OCI_SUCCESS;
+        }
+    }
 
     if (res == OCI_SUCCESS || res == OCI_SUCCESS_WITH_INFO)
     {
@@ -146,6 +273,74 @@ int oracle_statement_backend::get_number_of_rows()
     return rows;
 }
 
+bool oracle_statement_backend::collect_bulk_errors(bool collect)
+{
+    collectBulkErrors_ = collect;
+    bulkErrors_.clear();
+
+    return true;
+}
+
+std::vector<bulk_error> oracle_statement_backend::get_bulk_errors()
+{
+    return bulkErrors_;
+}
+
+void oracle_statement_backend::read_bulk_errors()
+{
+    ub4 numErrors = 0;
+    sword res = OCIAttrGet(stmtp_, OCI_HTYPE_STMT, &numErrors, 0,
+        OCI_ATTR_NUM_DML_ERRORS, session_.errhp_);
+    if (res != OCI_SUCCESS)
+    {
+        throw_oracle_soci_error(res, session_.errhp_);
+    }
+
+    if (numErrors == 0)
+    {
+        return;
+    }
+
+    OCIError *rowErrhp = NULL;
+    res = OCIHandleAlloc(session_.envhp_,
+        reinterpret_cast<dvoid**>(&rowErrhp), OCI_HTYPE_ERROR, 0, 0);
+    if (res != OCI_SUCCESS)
+    {
+        throw soci_error("Cannot allocate error handle");
+    }
+
+    for (ub4 i = 0; i != numErrors; ++i)
+    {
+        res = OCIParamGet(session_.errhp_, OCI_HTYPE_ERROR, session_.errhp_,
+            reinterpret_cast<dvoid**>(&rowErrhp), i);
+        if (res != OCI_SUCCESS)
+        {
+            break;
+        }
+
+        ub4 rowOffset = 0;
+        res = OCIAttrGet(rowErrhp, OCI_HTYPE_ERROR, &rowOffset, 0,
+            OCI_ATTR_DML_ROW_OFFSET, session_.errhp_);
+        if (res != OCI_SUCCESS)
+        {
+            break;
+        }
+
+        bulk_error error;
+        error.row = rowOffset;
+        get_error_details(OCI_ERROR, rowErrhp, error.message, error.code);
+        bulkErrors_.push_back(error);
+    }
+
+    OCIHandleFree(rowErrhp, OCI_HTYPE_ERROR);
+
+    if (res != OCI_SUCCESS)
+    {
+        bulkErrors_.clear();
+        throw_oracle_soci_error(res, session_.errhp_);
+    }
+}
+
 std::string oracle_statement_backend::get_parameter_name(int /* index */) const
 {
     // TODO: How to get the parameter names from the query we prepared?
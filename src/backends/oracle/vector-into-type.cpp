@@ -185,6 +185,21 @@ void oracle_vector_into_type_backend::define_by_pos_bulk(
             dataBuf = buf_;
         }
         break;
+    case x_binary:
+        {
+            // This is meant for RAW columns, whose size is known, BLOB ones
+            // must be fetched using blob objects.
+            oracleType = SQLT_BIN;
+            const std::size_t vecSize = size();
+            colSize_ = statement_.column_size(position);
+            buf_ = new char[colSize_ * vecSize];
+
+            prepare_indicators(vecSize);
+
+            elementSize = static_cast<sb4>(colSize_);
+            dataBuf = buf_;
+        }
+        break;
     case x_stdtm:
         {
             oracleType = SQLT_DAT;
@@ -276,6 +291,22 @@ void oracle_vector_into_type_backend::post_fetch(bool gotData, indicator * ind)
                 pos += colSize_;
             }
         }
+        else if (type_ == x_binary)
+        {
+            std::vector<std::vector<uint8_t> > &v
+                = exchange_vector_type_cast<x_binary>(data_);
+
+            char *pos = buf_;
+            std::size_t const vecSize = size();
+            for (std::size_t i = 0; i != vecSize; ++i)
+            {
+                if (indOCIHolderVec_[i] != -1)
+                {
+                    v[begin_ + i].assign(pos, pos + sizes_[i]);
+                }
+                pos += colSize_;
+            }
+        }
         else if (type_ == x_int64)
         {
             std::vector<int64_t> *vp
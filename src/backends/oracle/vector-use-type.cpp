@@ -16,6 +16,7 @@
 #include <cstdio>
 #include <cstring>
 #include <ctime>
+#include <limits>
 #include <sstream>
 
 #ifdef _MSC_VER
@@ -182,6 +183,47 @@ void oracle_vector_use_type_backend::prepare_for_bind(
             elementSize = static_cast<sb4>(maxSize);
         }
         break;
+    case x_binary:
+        {
+            std::vector<std::vector<uint8_t> > &v
+                = exchange_vector_type_cast<x_binary>(data_);
+
+            std::size_t maxSize = 0;
+            std::size_t const vecSize = size();
+            prepare_indicators(vecSize);
+            sizes_.resize(vecSize);
+            for (std::size_t i = 0; i != vecSize; ++i)
+            {
+                std::size_t sz = v[begin_ + i].size();
+                if (sz > (std::numeric_limits<ub2>::max)())
+                {
+                    throw soci_error("Binary value is too long to be bound "
+                                     "as an element of a vector.");
+                }
+
+                sizes_[i] = static_cast<ub2>(sz);
+                maxSize = sz > maxSize ? sz : maxSize;
+            }
+
+            // The buffer can't be empty even if all values are.
+            if (maxSize == 0)
+                maxSize = 1;
+
+            buf_ = new char[maxSize * vecSize];
+            char *pos = buf_;
+            for (std::size_t i = 0; i != vecSize; ++i)
+            {
+                std::vector<uint8_t> const &value = v[begin_ + i];
+                if (!value.empty())
+                    std::memcpy(pos, &value[0], value.size());
+                pos += maxSize;
+            }
+
+            oracleType = SQLT_BIN;
+            data = buf_;
+            elementSize = static_cast<sb4>(maxSize);
+        }
+        break;
     case x_stdtm:
         {
             std::size_t const vecSize = size();
@@ -229,6 +271,8 @@ void oracle_vector_use_type_backend::bind_by_pos_bulk(int & position,
 
     end_var_ = full_size();
 
+    statement_.hasVectorUseElements_ = true;
+
     bind_position_ = position++;
 }
 
@@ -243,6 +287,8 @@ void oracle_vector_use_type_backend::bind_by_name_bulk(
 
     end_var_ = full_size();
 
+    statement_.hasVectorUseElements_ = true;
+
     bind_name_ = name;
 }
 
@@ -254,14 +300,14 @@ void oracle_vector_use_type_backend::pre_use(indicator const *ind)
 
     prepare_for_bind(dataBuf, elementSize, oracleType);
 
-    ub2 *sizesP = 0; // used only for std::string
-    if (type_ == x_stdstring)
+    ub2 *sizesP = 0; // used only for std::string and binary values
+    if (type_ == x_stdstring || type_ == x_binary)
     {
         sizesP = &sizes_[0];
     }
 
     // first deal with data
-    if (type_ == x_stdstring)
+    if (type_ == x_stdstring || type_ == x_binary)
     {
         // nothing to do - already done in prepare_for_bind()
     }
@@ -77,6 +77,10 @@ details::postgresql_result::check_for_data(char const* errMsg) const
             return false;
 
         case PGRES_TUPLES_OK:
+        case PGRES_SINGLE_TUPLE:
+#ifdef LIBPQ_HAS_CHUNK_MODE
+        case PGRES_TUPLES_CHUNK:
+#endif
             return true;
 
         case PGRES_FATAL_ERROR:
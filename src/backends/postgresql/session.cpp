@@ -12,11 +12,20 @@
 #include "soci-compiler.h"
 #include <libpq/libpq-fs.h> // libpq
 #include <cctype>
+#include <cerrno>
+#include <chrono>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <ctime>
 #include <sstream>
 
+#ifdef _WIN32
+#include <winsock2.h>
+#else
+#include <poll.h>
+#endif
+
 using namespace soci;
 using namespace soci::details;
 
@@ -142,9 +151,10 @@ std::string create_case_list_of_strings(const std::vector<std::string>& list)
 
 postgresql_session_backend::postgresql_session_backend(
     connection_parameters const& parameters)
-    : statementCount_(0), conn_(0)
+    : statementCount_(0), transactionsEnded_(0), conn_(0)
 {
     single_row_mode_ = false;
+    use_cursors_ = false;
 
     connect(parameters);
 }
@@ -177,6 +187,17 @@ void postgresql_session_backend::connect(
         single_row_mode_ = connection_parameters::is_true_value(name, value);
     }
 
+    if (params.extract_option("cursors", value))
+    {
+        use_cursors_ = connection_parameters::is_true_value("cursors", value);
+    }
+
+    bool preloadTypes = false;
+    if (params.extract_option("preloadtypes", value))
+    {
+        preloadTypes = connection_parameters::is_true_value("preloadtypes", value);
+    }
+
     // We can't use SOCI connection string with PQconnectdb() directly because
     // libpq uses single quotes instead of double quotes used by SOCI.
     PGconn* conn = PQconnectdb(params.build_string_from_options('\'').c_str());
@@ -205,6 +226,15 @@ void postgresql_session_backend::connect(
 
     conn_ = conn;
     connectionParameters_ = parameters;
+
+    // The types could have changed if we're reconnecting, and OIDs are not
+    // the same in different databases anyhow.
+    categoryByTypeOID_.clear();
+
+    if (preloadTypes)
+    {
+        preload_type_categories();
+    }
 }
 
 postgresql_session_backend::~postgresql_session_backend()
@@ -233,11 +263,13 @@ void postgresql_session_backend::begin()
 
 void postgresql_session_backend::commit()
 {
+    ++transactionsEnded_;
     hard_exec(*this, conn_, "COMMIT", "Cannot commit transaction.");
 }
 
 void postgresql_session_backend::rollback()
 {
+    ++transactionsEnded_;
     hard_exec(*this, conn_, "ROLLBACK", "Cannot rollback transaction.");
 }
 
@@ -274,6 +306,173 @@ std::string postgresql_session_backend::get_next_statement_name()
     return nameBuf;
 }
 
+char postgresql_session_backend::get_type_category(unsigned long typeOid)
+{
+    CategoryByTypeOID::const_iterator const it = categoryByTypeOID_.find(typeOid);
+    if (it != categoryByTypeOID_.end())
+    {
+        return it->second;
+    }
+
+    std::ostringstream query;
+    query << "SELECT typcategory FROM pg_type WHERE oid=" << typeOid;
+
+    postgresql_result res(*this, PQexec(conn_, query.str().c_str()));
+    if (PQresultStatus(res) != PGRES_TUPLES_OK || PQntuples(res) != 1)
+    {
+        return '\0';
+    }
+
+    char const typeCategory = PQgetvalue(res, 0, 0)[0];
+    categoryByTypeOID_[typeOid] = typeCategory;
+
+    return typeCategory;
+}
+
+void postgresql_session_backend::preload_type_categories()
+{
+    // All built-in types have OIDs less than FirstNormalObjectId (16384) and
+    // are handled by describe_column() without querying their category.
+    postgresql_result res(*this,
+        PQexec(conn_, "SELECT oid, typcategory FROM pg_type WHERE oid >= 16384"));
+    res.check_for_errors("Cannot retrieve type categories.");
+
+    int const rows = PQntuples(res);
+    for (int i = 0; i != rows; ++i)
+    {
+        unsigned long const typeOid = std::strtoul(PQgetvalue(res, i, 0), NULL, 10);
+        categoryByTypeOID_[typeOid] = PQgetvalue(res, i, 1)[0];
+    }
+}
+
+void postgresql_session_backend::listen(std::string const & channel)
+{
+    char * const name = PQescapeIdentifier(conn_, channel.c_str(), channel.length());
+    if (name == NULL)
+    {
+        throw soci_error(std::string("Cannot quote channel name: ") + PQerrorMessage(conn_));
+    }
+
+    std::string const query = std::string("LISTEN ") + name;
+    PQfreemem(name);
+
+    hard_exec(*this, conn_, query.c_str(), "Cannot listen to channel.");
+}
+
+void postgresql_session_backend::unlisten(std::string const & channel)
+{
+    char * const name = PQescapeIdentifier(conn_, channel.c_str(), channel.length());
+    if (name == NULL)
+    {
+        throw soci_error(std::string("Cannot quote channel name: ") + PQerrorMessage(conn_));
+    }
+
+    std::string const query = std::string("UNLISTEN ") + name;
+    PQfreemem(name);
+
+    hard_exec(*this, conn_, query.c_str(), "Cannot stop listening to channel.");
+}
+
+bool postgresql_session_backend::get_notification(
+    postgresql_notification & notification)
+{
+    // Notifications received while executing other queries are already
+    // queued, so check for them before reading anything from the socket.
+    PGnotify * notify = PQnotifies(conn_);
+    if (notify == NULL)
+    {
+        if (PQconsumeInput(conn_) != 1)
+        {
+            throw soci_error(std::string("Cannot read notifications: ") + PQerrorMessage(conn_));
+        }
+
+        notify = PQnotifies(conn_);
+        if (notify == NULL)
+        {
+            return false;
+        }
+    }
+
+    notification.channel = notify->relname;
+    notification.payload = notify->extra ? notify->extra : "";
+    notification.pid = notify->be_pid;
+
+    PQfreemem(notify);
+
+    return true;
+}
+
+bool postgresql_session_backend::wait_for_notification(
+    postgresql_notification & notification, int timeoutMs)
+{
+    typedef std::chrono::steady_clock clock;
+    clock::time_point const deadline = clock::now() + std::chrono::milliseconds(timeoutMs);
+
+    for (;;)
+    {
+        if (get_notification(notification))
+        {
+            return true;
+        }
+
+        int const sock = PQsocket(conn_);
+        if (sock < 0)
+        {
+            throw soci_error("Cannot wait for notifications: no connection to the server.");
+        }
+
+        // Use poll() rather than select() as the socket may be greater than
+        // FD_SETSIZE in a process with many open descriptors.
+        int waitMs = -1;
+        if (timeoutMs >= 0)
+        {
+            long long const remaining = std::chrono::duration_cast<std::chrono::microseconds>(
+                deadline - clock::now()).count();
+            if (remaining < 0)
+            {
+                return false;
+            }
+
+            // Round up to avoid spinning when less than 1ms remains.
+            waitMs = static_cast<int>((remaining + 999) / 1000);
+        }
+
+#ifdef _WIN32
+        WSAPOLLFD pfd;
+        pfd.fd = static_cast<SOCKET>(sock);
+        pfd.events = POLLRDNORM;
+        pfd.revents = 0;
+
+        int const rc = WSAPoll(&pfd, 1, waitMs);
+#else
+        pollfd pfd;
+        pfd.fd = sock;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+
+        int const rc = poll(&pfd, 1, waitMs);
+#endif
+        if (rc < 0)
+        {
+#ifndef _WIN32
+            if (errno == EINTR)
+            {
+                continue;
+            }
+#endif
+
+            throw soci_error("Cannot wait for notifications: poll() failed.");
+        }
+
+        if (rc == 0)
+        {
+            // Timeout expired, but check for the notification one last time
+            // in case it arrived just now.
+            return get_notification(notification);
+        }
+    }
+}
+
 postgresql_statement_backend * postgresql_session_backend::make_statement_backend()
 {
     return new postgresql_statement_backend(*this, single_row_mode_);
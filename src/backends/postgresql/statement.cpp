@@ -49,13 +49,158 @@ void throw_soci_error(PGconn * conn, const char * msg)
     throw soci_error(description);
 }
 
+// used in single-row mode right after sending the query: for bulk fetches,
+// ask libpq to return the rows in chunks of the vector size if it supports
+// it, otherwise fall back to returning them one by one
+void set_single_row_mode(PGconn * conn, int number)
+{
+#ifdef LIBPQ_HAS_CHUNK_MODE
+    if (number > 1)
+    {
+        if (PQsetChunkedRowsMode(conn, number) != 1)
+        {
+            throw_soci_error(conn, "Cannot set chunked rows mode");
+        }
+
+        return;
+    }
+#else
+    SOCI_UNUSED(number);
+#endif
+
+    if (PQsetSingleRowMode(conn) != 1)
+    {
+        throw_soci_error(conn, "Cannot set single-row mode");
+    }
+}
+
+// append rows [from, to) of the source result to the end of the destination
+// one, which must have the same columns
+void append_rows(PGresult * dest, PGresult const * src, int from, int to)
+{
+    int const columns = PQnfields(src);
+    int row = PQntuples(dest);
+    for (int i = from; i != to; ++i, ++row)
+    {
+        for (int col = 0; col != columns; ++col)
+        {
+            int res;
+            if (PQgetisnull(src, i, col) != 0)
+            {
+                res = PQsetvalue(dest, row, col, NULL, -1);
+            }
+            else
+            {
+                res = PQsetvalue(dest, row, col,
+                    PQgetvalue(src, i, col), PQgetlength(src, i, col));
+            }
+
+            if (res != 1)
+            {
+                throw soci_error("Cannot store the fetched rows.");
+            }
+        }
+    }
+}
+
+// replace the result with a copy containing only its rows [from, to), so
+// that more rows can be appended to it using append_rows()
+void keep_rows(postgresql_result & result, int from, int to)
+{
+    PGresult * const rowsCopy = PQcopyResult(result.get_result(), PG_COPYRES_ATTRS);
+    if (rowsCopy == NULL)
+    {
+        throw soci_error("Cannot store the fetched rows.");
+    }
+
+    postgresql_result copy(result.get_session_backend(), rowsCopy);
+    append_rows(rowsCopy, result, from, to);
+    result.reset(copy.release());
+}
+
+// check whether the query contains any data-modifying keyword outside of the
+// string literals and quoted identifiers
+bool has_modifying_keyword(std::string::const_iterator it,
+                           std::string::const_iterator end)
+{
+    while (it != end)
+    {
+        char const c = *it;
+        if (c == '\'' || c == '"')
+        {
+            // skip the quoted part, doubled quotes inside it don't matter as
+            // they're just two consecutive quoted parts
+            ++it;
+            while (it != end && *it != c)
+            {
+                ++it;
+            }
+
+            if (it != end)
+            {
+                ++it;
+            }
+        }
+        else if (std::isalpha(static_cast<unsigned char>(c)) || c == '_')
+        {
+            std::string word;
+            while (it != end && (std::isalnum(static_cast<unsigned char>(*it)) || *it == '_'))
+            {
+                word += static_cast<char>(std::tolower(static_cast<unsigned char>(*it)));
+                ++it;
+            }
+
+            if (word == "insert" || word == "update" ||
+                word == "delete" || word == "merge")
+            {
+                return true;
+            }
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return false;
+}
+
+// check whether the query is a SELECT (or VALUES) one for which a cursor
+// can be declared
+bool is_cursor_query(std::string const & query)
+{
+    std::string::const_iterator it = query.begin();
+    while (it != query.end() && (std::isspace(static_cast<unsigned char>(*it)) || *it == '('))
+    {
+        ++it;
+    }
+
+    std::string keyword;
+    while (it != query.end() && std::isalpha(static_cast<unsigned char>(*it)))
+    {
+        keyword += static_cast<char>(std::tolower(static_cast<unsigned char>(*it)));
+        ++it;
+    }
+
+    // WITH queries can contain data-modifying statements, which can't be
+    // used with cursors, so only accept them if they don't seem to do it.
+    if (keyword == "with")
+    {
+        return !has_modifying_keyword(it, query.end());
+    }
+
+    return keyword == "select" || keyword == "values" || keyword == "table";
+}
+
 } // unnamed namespace
 
 postgresql_statement_backend::postgresql_statement_backend(
     postgresql_session_backend &session, bool single_row_mode)
     : session_(session), single_row_mode_(single_row_mode),
+      use_cursor_(session.use_cursors_), use_cursor_explicitly_(false),
+      cursorTransaction_(0),
       result_(session, NULL),
-      rowsAffectedBulk_(-1LL), justDescribed_(false),
+      rowsAffectedBulk_(-1LL), endOfRows_(false), justDescribed_(false),
       hasIntoElements_(false), hasVectorIntoElements_(false),
       hasUseElements_(false), hasVectorUseElements_(false)
 {
@@ -90,7 +235,94 @@ void postgresql_statement_backend::clean_up()
     // potential new execution.
     rowsAffectedBulk_ = -1;
 
-    // nothing to do here
+    try
+    {
+        close_cursor();
+    }
+    catch (...)
+    {
+        // This is called from the statement dtor, so don't let exceptions
+        // escape from here. The cursor will be closed at the end of the
+        // transaction anyhow.
+    }
+}
+
+void postgresql_statement_backend::declare_cursor(
+    std::vector<char *> const & paramValues, int number)
+{
+    std::string const cursorName = session_.get_next_statement_name() + "_cursor";
+
+    std::string const query = "DECLARE " + cursorName + " NO SCROLL CURSOR FOR " + query_;
+    postgresql_result result(session_,
+        PQexecParams(session_.conn_, query.c_str(),
+            static_cast<int>(paramValues.size()), NULL,
+            paramValues.empty() ? NULL : &paramValues[0], NULL, NULL, 0));
+    result.check_for_errors("Cannot declare cursor.");
+
+    cursorName_ = cursorName;
+    cursorTransaction_ = session_.transactionsEnded_;
+
+    // Fetch the first batch immediately, this is what execute() does in the
+    // default mode too. If we're executing the statement without fetching
+    // any data yet, the row fetched here will be consumed by fetch() later.
+    result_.reset(fetch_from_cursor(number > 0 ? number : 1));
+}
+
+PGresult * postgresql_statement_backend::fetch_from_cursor(int number)
+{
+    std::ostringstream query;
+    query << "FETCH FORWARD " << number << " FROM " << cursorName_;
+
+    postgresql_result result(session_, PQexec(session_.conn_, query.str().c_str()));
+    result.check_for_data("Cannot fetch from cursor.");
+
+    if (PQntuples(result) < number)
+    {
+        // there are no more rows, no need to keep the cursor open any longer
+        close_cursor();
+    }
+
+    return result.release();
+}
+
+void postgresql_statement_backend::close_cursor()
+{
+    if (cursorName_.empty())
+    {
+        return;
+    }
+
+    std::string const cursorName = cursorName_;
+    cursorName_.clear();
+
+    // The cursor is closed automatically at the end of the transaction in
+    // which it was declared, and trying to close it again would fail and
+    // abort the current transaction, if any, so only do it if it's still
+    // the same one.
+    if (cursorTransaction_ != session_.transactionsEnded_ ||
+        PQtransactionStatus(session_.conn_) != PQTRANS_INTRANS)
+    {
+        return;
+    }
+
+    // The cursor can also have been closed without SOCI knowing about it,
+    // e.g. by rolling back to a savepoint established before declaring it or
+    // by committing the transaction using a query, so check that it still
+    // exists before closing it.
+    char const * const name = cursorName.c_str();
+    postgresql_result exists(session_,
+        PQexecParams(session_.conn_,
+            "SELECT 1 FROM pg_cursors WHERE name = $1",
+            1, NULL, &name, NULL, NULL, 0));
+    exists.check_for_data("Cannot check if cursor exists.");
+    if (PQntuples(exists) == 0)
+    {
+        return;
+    }
+
+    std::string const query = "CLOSE " + cursorName;
+    postgresql_result(session_, PQexec(session_.conn_, query.c_str()))
+        .check_for_errors("Cannot close cursor.");
 }
 
 void postgresql_statement_backend::prepare(std::string const & query,
@@ -255,9 +487,9 @@ void postgresql_statement_backend::prepare(std::string const & query,
 statement_backend::exec_fetch_result
 postgresql_statement_backend::execute(int number)
 {
-    if (single_row_mode_ && (number > 1))
+    if (single_row_mode_ && (number > 1) && hasVectorUseElements_)
     {
-        throw soci_error("Bulk operations are not supported with single-row mode.");
+        throw soci_error("Bulk use operations are not supported with single-row mode.");
     }
 
     // If the statement was "just described", then we know that
@@ -275,6 +507,17 @@ postgresql_statement_backend::execute(int number)
         // This object could have been already filled with data before.
         clean_up();
 
+        // Server-side cursors can only be used for queries returning rows
+        // and only inside a transaction, as they're closed at its end. They
+        // are also only worth using for fetching the rows in batches, as the
+        // extra round trips are wasteful for the queries returning a single
+        // row, unless the cursor was requested for this statement.
+        bool const useCursor = use_cursor_ &&
+            (hasVectorIntoElements_ || use_cursor_explicitly_) &&
+            !single_row_mode_ &&
+            is_cursor_query(query_) &&
+            PQtransactionStatus(session_.conn_) == PQTRANS_INTRANS;
+
         if ((number > 1) && hasIntoElements_)
         {
              throw soci_error(
@@ -349,7 +592,14 @@ postgresql_statement_backend::execute(int number)
                     }
                 }
 
-                if (stType_ == st_repeatable_query)
+                if (useCursor)
+                {
+                    // the query is executed as part of the cursor
+                    // declaration, whether it was prepared or not
+
+                    declare_cursor(paramValues, number);
+                }
+                else if (stType_ == st_repeatable_query)
                 {
                     // this query was separately prepared
 
@@ -365,12 +615,7 @@ postgresql_statement_backend::execute(int number)
                                 "Cannot execute prepared query in single-row mode");
                         }
 
-                        result = PQsetSingleRowMode(session_.conn_);
-                        if (result != 1)
-                        {
-                            throw_soci_error(session_.conn_,
-                                "Cannot set singlerow mode");
-                        }
+                        set_single_row_mode(session_.conn_, number);
                     }
                     else
                     {
@@ -398,12 +643,7 @@ postgresql_statement_backend::execute(int number)
                                 "cannot execute query in single-row mode");
                         }
 
-                        result = PQsetSingleRowMode(session_.conn_);
-                        if (result != 1)
-                        {
-                            throw_soci_error(session_.conn_,
-                                "Cannot set singlerow mode");
-                        }
+                        set_single_row_mode(session_.conn_, number);
                     }
                     else
                     {
@@ -442,7 +682,11 @@ postgresql_statement_backend::execute(int number)
         {
             // there are no use elements
             // - execute the query without parameter information
-            if (stType_ == st_repeatable_query)
+            if (useCursor)
+            {
+                declare_cursor(std::vector<char *>(), number);
+            }
+            else if (stType_ == st_repeatable_query)
             {
                 // this query was separately prepared
 
@@ -456,12 +700,7 @@ postgresql_statement_backend::execute(int number)
                             "Cannot execute prepared query in single-row mode");
                     }
 
-                    result = PQsetSingleRowMode(session_.conn_);
-                    if (result != 1)
-                    {
-                        throw_soci_error(session_.conn_,
-                            "Cannot set singlerow mode");
-                    }
+                    set_single_row_mode(session_.conn_, number);
                 }
                 else
                 {
@@ -482,12 +721,7 @@ postgresql_statement_backend::execute(int number)
                             "Cannot execute query in single-row mode");
                     }
 
-                    result = PQsetSingleRowMode(session_.conn_);
-                    if (result != 1)
-                    {
-                        throw_soci_error(session_.conn_,
-                            "Cannot set single-row mode");
-                    }
+                    set_single_row_mode(session_.conn_, number);
                 }
                 else
                 {
@@ -511,9 +745,18 @@ postgresql_statement_backend::execute(int number)
         {
             PGresult * res = PQgetResult(session_.conn_);
             result_.reset(res);
+
+            endOfRows_ = false;
         }
 
         process_result = result_.check_for_data("Cannot execute query.");
+        if (!process_result)
+        {
+            // there are no rows to wait for, but the end of the results
+            // still has to be consumed before the next query can be sent
+            wait_until_operation_complete(session_);
+            endOfRows_ = true;
+        }
     }
     else
     {
@@ -532,6 +775,12 @@ postgresql_statement_backend::execute(int number)
         numberOfRows_ = PQntuples(result_);
         if (numberOfRows_ == 0)
         {
+            if (single_row_mode_ && !endOfRows_)
+            {
+                wait_until_operation_complete(session_);
+                endOfRows_ = true;
+            }
+
             return ef_no_data;
         }
         else
@@ -557,94 +806,136 @@ postgresql_statement_backend::execute(int number)
 statement_backend::exec_fetch_result
 postgresql_statement_backend::fetch(int number)
 {
-    if (single_row_mode_ && (number > 1))
-    {
-        throw soci_error("Bulk operations are not supported with single-row mode.");
-    }
-
     // Note:
     // In the multi-row mode this function does not actually fetch anything from anywhere
     // - the data was already retrieved from the server in the execute()
     // function, and the actual consumption of this data will take place
     // in the postFetch functions, called for each into element.
     // Here, we only prepare for this to happen (to emulate "the Oracle way").
-    // In the single-row mode the fetch of single row of data is performed as expected.
+    // In the single-row mode the rows are retrieved from the server as
+    // needed, see fetch_single_rows(), and when using a cursor, the next
+    // batch of rows is fetched from it here.
 
     // forward the "cursor" from the last fetch
     currentRow_ += rowsToConsume_;
 
-    if (currentRow_ >= numberOfRows_)
+    if (single_row_mode_)
     {
-        if (single_row_mode_)
-        {
-            PGresult* res = PQgetResult(session_.conn_);
-            result_.reset(res);
+        return fetch_single_rows(number);
+    }
 
-            if (res == NULL)
+    if (!cursorName_.empty())
+    {
+        // get the rows which are not in the current batch yet from the cursor
+        int const available = numberOfRows_ - currentRow_;
+        if (available < number)
+        {
+            postgresql_result next(session_, fetch_from_cursor(number - available));
+            if (available == 0)
             {
-                return ef_no_data;
+                result_.reset(next.release());
+            }
+            else
+            {
+                keep_rows(result_, currentRow_, numberOfRows_);
+                append_rows(result_.get_result(), next, 0, PQntuples(next));
             }
 
             currentRow_ = 0;
-            rowsToConsume_ = 0;
-
             numberOfRows_ = PQntuples(result_);
-            if (numberOfRows_ == 0)
-            {
-                return ef_no_data;
-            }
-            else
-            {
-                rowsToConsume_ = 1;
+        }
+    }
 
-                return ef_success;
-            }
+    if (currentRow_ >= numberOfRows_)
+    {
+        // all rows were already consumed
+
+        return ef_no_data;
+    }
+    else
+    {
+        if (currentRow_ + number > numberOfRows_)
+        {
+            rowsToConsume_ = numberOfRows_ - currentRow_;
+
+            // this simulates the behaviour of Oracle
+            // - when EOF is hit, we return ef_no_data even when there are
+            // actually some rows fetched
+            return ef_no_data;
         }
         else
         {
-            // default multi-row execution
-
-            // all rows were already consumed
+            rowsToConsume_ = number;
 
-            return ef_no_data;
+            return ef_success;
         }
     }
-    else
+}
+
+statement_backend::exec_fetch_result
+postgresql_statement_backend::fetch_single_rows(int number)
+{
+    // Each PQgetResult() call returns either a single row or, when using the
+    // chunked rows mode, up to the number of rows passed to execute(). If we
+    // need more rows than what remains in the current result, accumulate
+    // them in a copy of it, so that the into elements can consume all of
+    // them at once, while never keeping more than about two vectors worth of
+    // rows in memory.
+    int available = numberOfRows_ - currentRow_;
+    bool accumulating = false;
+    while (available < number && !endOfRows_)
     {
-        if (currentRow_ + number > numberOfRows_)
+        postgresql_result next(session_, PQgetResult(session_.conn_));
+        if (next.get_result() == NULL)
         {
-            if (single_row_mode_)
-            {
-                rowsToConsume_ = 1;
+            endOfRows_ = true;
+            break;
+        }
 
-                return ef_success;
-            }
-            else
-            {
-                // default multi-row execution
+        next.check_for_data("Cannot fetch data in single-row mode.");
 
-                rowsToConsume_ = numberOfRows_ - currentRow_;
+        int const rows = PQntuples(next);
+        if (rows == 0)
+        {
+            // this is the final result indicating the end of the rowset
+            wait_until_operation_complete(session_);
+            endOfRows_ = true;
+            break;
+        }
 
-                // this simulates the behaviour of Oracle
-                // - when EOF is hit, we return ef_no_data even when there are
-                // actually some rows fetched
-                return ef_no_data;
-            }
+        if (available == 0)
+        {
+            // nothing left in the current result, just take the new one
+            result_.reset(next.release());
         }
         else
         {
-            if (single_row_mode_)
+            if (!accumulating)
             {
-                rowsToConsume_ = 1;
-            }
-            else
-            {
-                rowsToConsume_ = number;
+                keep_rows(result_, currentRow_, numberOfRows_);
+                accumulating = true;
             }
 
-            return ef_success;
+            append_rows(result_.get_result(), next, 0, rows);
         }
+
+        currentRow_ = 0;
+        available += rows;
+        numberOfRows_ = available;
+    }
+
+    if (available >= number)
+    {
+        rowsToConsume_ = number;
+
+        return ef_success;
     }
+
+    // as in the multi-row mode, the last bunch of rows is returned together
+    // with the end-of-rowset indication
+    rowsToConsume_ = available;
+
+    return ef_no_data;
 }
 
 long long postgresql_statement_backend::get_affected_rows()
@@ -782,29 +1073,8 @@ void postgresql_statement_backend::describe_column(int colNum,
 
     default:
     {
-        auto typeCategoryIt = categoryByColumnOID_.find(typeOid);
-        if ( typeCategoryIt == categoryByColumnOID_.end() )
-        {
-            std::stringstream query;
-            query << "SELECT typcategory FROM pg_type WHERE oid=" << (int)typeOid;
-
-            soci::details::postgresql_result res(session_, PQexec(session_.conn_, query.str().c_str()));
-            if ( PQresultStatus(res.get_result()) != PGRES_TUPLES_OK )
-            {
-                throw_soci_type_error(typeOid, colNum, '\0', PQfname(result_, pos));
-            }
-
-            char* typeVal = PQgetvalue(res.get_result(), 0, 0);
-            auto iter_inserted = categoryByColumnOID_.insert( std::pair<unsigned long, char>( typeOid, typeVal[0] ) );
-            if ( !iter_inserted.second )
-            {
-                throw_soci_type_error(typeOid, colNum, typeVal[0], PQfname(result_, pos));
-            }
-
-            typeCategoryIt = iter_inserted.first;
-        }
-
-        char typeCategory = (*typeCategoryIt).second;
+        // Unknown types have '\0' category and result in an error below.
+        char const typeCategory = session_.get_type_category(typeOid);
         switch ( typeCategory )
         {
             case 'D': // date type
@@ -186,6 +186,24 @@ void postgresql_vector_into_type_backend::post_fetch(bool gotData, indicator * i
             case x_longstring:
                 set_invector_wrappers_<long_string, std::string>(data_, i, buf);
                 break;
+            case x_binary:
+                {
+                    // bytea values are returned in either hex or escape
+                    // format, depending on the server settings
+                    std::size_t len = 0;
+                    unsigned char * const bytes = PQunescapeBytea(
+                        reinterpret_cast<unsigned char const *>(buf), &len);
+                    if (bytes == NULL)
+                    {
+                        throw soci_error("Failed to decode binary value.");
+                    }
+
+                    std::vector<uint8_t> & v =
+                        (*static_cast<std::vector<std::vector<uint8_t> > *>(data_))[i];
+                    v.assign(bytes, bytes + len);
+                    PQfreemem(bytes);
+                }
+                break;
 
             default:
                 throw soci_error("Into element used with non-supported type.");
@@ -263,6 +281,9 @@ void postgresql_vector_into_type_backend::resize(std::size_t sz)
         case x_longstring:
             resizevector_<long_string>(data_, sz);
             break;
+        case x_binary:
+            resizevector_<std::vector<uint8_t> >(data_, sz);
+            break;
         default:
             throw soci_error("Into vector element used with non-supported type.");
         }
@@ -343,6 +364,9 @@ std::size_t postgresql_vector_into_type_backend::full_size()
     case x_longstring:
         sz = get_vector_size<long_string>(data_);
         break;
+    case x_binary:
+        sz = get_vector_size<std::vector<uint8_t> >(data_);
+        break;
     default:
         throw soci_error("Into vector element used with non-supported type.");
     }
@@ -242,6 +242,28 @@ void postgresql_vector_use_type_backend::pre_use(indicator const * ind)
                     std::strcpy(buf, v[i].value.c_str());
                 }
                 break;
+            case x_binary:
+                {
+                    std::vector<std::vector<uint8_t> > * pv
+                        = static_cast<std::vector<std::vector<uint8_t> > *>(data_);
+                    std::vector<uint8_t> & v = (*pv)[i];
+
+                    // use bytea hex format: "\x" followed by 2 hex digits
+                    // for each byte
+                    static char const hexDigits[] = "0123456789abcdef";
+
+                    buf = new char[2 * v.size() + 3];
+                    char * p = buf;
+                    *p++ = '\\';
+                    *p++ = 'x';
+                    for (std::size_t n = 0; n != v.size(); ++n)
+                    {
+                        *p++ = hexDigits[v[n] >> 4];
+                        *p++ = hexDigits[v[n] & 0x0f];
+                    }
+                    *p = '\0';
+                }
+                break;
 
             default:
                 throw soci_error(
@@ -333,6 +355,9 @@ std::size_t postgresql_vector_use_type_backend::full_size()
     case x_longstring:
         sz = get_vector_size<long_string>(data_);
         break;
+    case x_binary:
+        sz = get_vector_size<std::vector<uint8_t> >(data_);
+        break;
     default:
         throw soci_error("Use vector element used with non-supported type.");
     }
@@ -9,17 +9,131 @@
 #include "soci/sqlite3/soci-sqlite3.h"
 
 #include <algorithm>
+#include <climits>
 #include <cstring>
+#include <sstream>
 
 using namespace soci;
+using namespace sqlite_api;
+
+namespace // anonymous
+{
+
+void check_blob_result(sqlite3_session_backend &session, int res,
+                       char const *what)
+{
+    if (res != SQLITE_OK)
+    {
+        std::ostringstream ss;
+        ss << what << ": " << sqlite3_errmsg(session.conn_);
+        throw sqlite3_soci_error(ss.str(), res);
+    }
+}
+
+int check_blob_size(std::size_t size)
+{
+    if (size > static_cast<std::size_t>(INT_MAX))
+    {
+        throw soci_error("BLOB data size is too big.");
+    }
+
+    return static_cast<int>(size);
+}
+
+} // namespace anonymous
 
 sqlite3_blob_backend::sqlite3_blob_backend(sqlite3_session_backend &backend)
     : details::trivial_blob_backend(backend)
+    , blob_(NULL)
 {
 }
 
 sqlite3_blob_backend::~sqlite3_blob_backend()
 {
+    if (blob_)
+        sqlite3_blob_close(blob_);
+}
+
+std::size_t sqlite3_blob_backend::get_len()
+{
+    if (!blob_)
+        return trivial_blob_backend::get_len();
+
+    return static_cast<std::size_t>(sqlite3_blob_bytes(blob_));
+}
+
+std::size_t sqlite3_blob_backend::read_from_start(void* buf, std::size_t toRead,
+    std::size_t offset)
+{
+    if (!blob_)
+        return trivial_blob_backend::read_from_start(buf, toRead, offset);
+
+    std::size_t const len = get_len();
+    if (offset > len || (offset == len && offset > 0))
+    {
+        throw soci_error("Can't read past-the-end of BLOB data.");
+    }
+
+    toRead = std::min<std::size_t>(toRead, len - offset);
+    if (toRead)
+    {
+        int const res = sqlite3_blob_read(blob_, buf,
+            check_blob_size(toRead), check_blob_size(offset));
+        check_blob_result(static_cast<sqlite3_session_backend &>(session_),
+                          res, "Failed to read BLOB data");
+    }
+
+    return toRead;
+}
+
+std::size_t sqlite3_blob_backend::write_from_start(const void* buf,
+    std::size_t toWrite, std::size_t offset)
+{
+    if (!blob_)
+        return trivial_blob_backend::write_from_start(buf, toWrite, offset);
+
+    if (offset > get_len() || toWrite > get_len() - offset)
+    {
+        throw soci_error("Can't change the size of BLOB opened for "
+                         "incremental I/O.");
+    }
+
+    if (toWrite)
+    {
+        int const res = sqlite3_blob_write(blob_, buf,
+            check_blob_size(toWrite), check_blob_size(offset));
+        check_blob_result(static_cast<sqlite3_session_backend &>(session_),
+                          res, "Failed to write BLOB data");
+    }
+
+    return toWrite;
+}
+
+std::size_t sqlite3_blob_backend::append(void const* buf, std::size_t toWrite)
+{
+    if (!blob_)
+        return trivial_blob_backend::append(buf, toWrite);
+
+    return write_from_start(buf, toWrite, get_len());
+}
+
+void sqlite3_blob_backend::trim(std::size_t newLen)
+{
+    if (!blob_)
+        return trivial_blob_backend::trim(newLen);
+
+    if (newLen != get_len())
+    {
+        throw soci_error("Can't change the size of BLOB opened for "
+                         "incremental I/O.");
+    }
+}
+
+std::size_t sqlite3_blob_backend::set_data(void const* buf, std::size_t toWrite)
+{
+    close();
+
+    return trivial_blob_backend::set_data(buf, toWrite);
 }
 
 void sqlite3_blob_backend::ensure_buffer_initialized()
@@ -29,3 +143,62 @@ void sqlite3_blob_backend::ensure_buffer_initialized()
     // to do so now.
     buffer_.reserve(1);
 }
+
+void sqlite3_blob_backend::open(std::string const &table,
+                                std::string const &column,
+                                sqlite3_int64 rowid, bool readWrite,
+                                std::string const &database)
+{
+    close();
+
+    // Don't keep the data which can't be accessed any longer.
+    buffer_.clear();
+
+    sqlite3_session_backend &session
+        = static_cast<sqlite3_session_backend &>(session_);
+
+    int const res = sqlite3_blob_open(session.conn_, database.c_str(),
+        table.c_str(), column.c_str(), rowid, readWrite ? 1 : 0, &blob_);
+    if (res != SQLITE_OK)
+    {
+        std::ostringstream ss;
+        ss << "Failed to open BLOB in column \"" << column << "\" of table \""
+           << table << "\" for row " << rowid << ": "
+           << sqlite3_errmsg(session.conn_);
+
+        // The handle should be NULL on error, but make sure it isn't used.
+        close();
+
+        throw sqlite3_soci_error(ss.str(), res);
+    }
+}
+
+void sqlite3_blob_backend::reopen(sqlite3_int64 rowid)
+{
+    if (!blob_)
+    {
+        throw soci_error("BLOB must be opened before it can be reopened.");
+    }
+
+    int const res = sqlite3_blob_reopen(blob_, rowid);
+    if (res != SQLITE_OK)
+    {
+        std::ostringstream ss;
+        ss << "Failed to reopen BLOB for row " << rowid << ": "
+           << sqlite3_errmsg(static_cast<sqlite3_session_backend &>(session_).conn_);
+
+        // The handle can't be used after a failure, but still must be closed.
+        close();
+
+        throw sqlite3_soci_error(ss.str(), res);
+    }
+}
+
+void sqlite3_blob_backend::close()
+{
+    if (blob_)
+    {
+        sqlite3_blob_close(blob_);
+        blob_ = NULL;
+    }
+}
@@ -10,8 +10,10 @@
 
 #include "soci/connection-parameters.h"
 
+#include "soci-case.h"
 #include "soci-cstrtoi.h"
 
+#include <cctype>
 #include <functional>
 #include <sstream>
 #include <string>
@@ -83,6 +85,34 @@ void check_sqlite_err(sqlite_api::sqlite3* conn, int res, char const* const errM
 
 } // namespace anonymous
 
+// Check if the query may change the database schema, which makes the column
+// information of the already prepared statements out of date (SQLite only
+// prepares them again when they're executed).
+static bool is_schema_changing_query(std::string const& query)
+{
+    std::string::size_type const start = query.find_first_not_of(" \t\r\n(");
+    if (start == std::string::npos)
+        return false;
+
+    std::string::size_type end = start;
+    while (end < query.size() && std::isalpha(static_cast<unsigned char>(query[end])))
+        ++end;
+
+    std::string const keyword = string_tolower(query.substr(start, end - start));
+    return keyword == "create" || keyword == "drop" || keyword == "alter" ||
+           keyword == "attach" || keyword == "detach";
+}
+
+// Callback storing the single string value returned by a hardcoded query.
+static int store_string_value_callback(void* ctxt, int result_columns, char** values, char**)
+{
+    std::string* const value = static_cast<std::string*>(ctxt);
+    if (result_columns == 1 && values[0])
+        *value = values[0];
+
+    return 0;
+}
+
 static int sequence_table_exists_callback(void* ctxt, int result_columns, char**, char**)
 {
     bool* const flag = static_cast<bool*>(ctxt);
@@ -108,12 +138,15 @@ static bool check_if_sequence_table_exists(sqlite_api::sqlite3* conn)
 sqlite3_session_backend::sqlite3_session_backend(
     connection_parameters const & parameters)
     : sequence_table_exists_(false)
+    , statementCacheSize_(0)
 {
     int timeout = 0;
     int connection_flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE;
     std::string vfs;
     std::string synchronous;
     std::string foreignKeys;
+    std::string journalMode;
+    std::string mmapSize;
     std::string const & connectString = parameters.get_connect_string();
     std::string dbname;
 
@@ -138,6 +171,18 @@ sqlite3_session_backend::sqlite3_session_backend(
         std::istringstream converter(val);
         converter >> timeout;
     }
+    if (params.get_option("statement_cache", val))
+    {
+        int size = 0;
+        std::istringstream converter(val);
+        converter >> size;
+        if (!converter || size < 0)
+        {
+            throw sqlite3_soci_error("Invalid statement_cache value \"" + val + "\"", 0);
+        }
+
+        statementCacheSize_ = static_cast<std::size_t>(size);
+    }
     if (params.get_option("synchronous", val))
     {
         synchronous = val;
@@ -156,6 +201,31 @@ sqlite3_session_backend::sqlite3_session_backend(
     }
     params.get_option("vfs", vfs);
     params.get_option("foreign_keys", foreignKeys);
+    // The values of the following options are inserted into the pragma
+    // queries, so check that they are valid first.
+    if (params.get_option("journal_mode", val))
+    {
+        std::string const mode = string_tolower(val);
+        if (mode != "delete" && mode != "truncate" && mode != "persist" &&
+                mode != "memory" && mode != "wal" && mode != "off")
+        {
+            throw sqlite3_soci_error("Invalid journal_mode value \"" + val + "\"", 0);
+        }
+
+        journalMode = val;
+    }
+    if (params.get_option("mmap_size", val))
+    {
+        long long size = 0;
+        if (!cstring_to_integer(size, val.c_str()))
+        {
+            throw sqlite3_soci_error("Invalid mmap_size value \"" + val + "\"", 0);
+        }
+
+        std::ostringstream oss;
+        oss << size;
+        mmapSize = oss.str();
+    }
 
     if (dbname.empty())
     {
@@ -192,6 +262,43 @@ sqlite3_session_backend::sqlite3_session_backend(
         );
     }
 
+    if (!journalMode.empty())
+    {
+        // This pragma returns the journal mode actually used, which may be
+        // different from the requested one, e.g. WAL can't be used with the
+        // in-memory databases, and we want to know about it.
+        std::string actualMode;
+        std::string const query("pragma journal_mode=" + journalMode);
+        execute_hardcoded(conn_, query.c_str(),
+            [&journalMode](std::ostream& ostr)
+            {
+                ostr << "Setting journal_mode pragma to \"" << journalMode << "\" failed";
+            },
+            &store_string_value_callback, &actualMode
+        );
+
+        if (string_tolower(actualMode) != string_tolower(journalMode))
+        {
+            sqlite3_close(conn_);
+
+            std::ostringstream ss;
+            ss << "Cannot use journal mode \"" << journalMode << "\" for \""
+               << dbname << "\", the database uses \"" << actualMode << "\"";
+            throw sqlite3_soci_error(ss.str(), 0);
+        }
+    }
+
+    if (!mmapSize.empty())
+    {
+        std::string const query("pragma mmap_size=" + mmapSize);
+        execute_hardcoded(conn_, query.c_str(),
+            [&mmapSize](std::ostream& ostr)
+            {
+                ostr << "Setting mmap_size pragma to \"" << mmapSize << "\" failed";
+            }
+        );
+    }
+
     res = sqlite3_busy_timeout(conn_, timeout * 1000);
     check_sqlite_err(conn_, res, "Failed to set busy timeout for connection. ");
 }
@@ -296,9 +403,81 @@ bool sqlite3_session_backend::get_last_insert_id(
 
 void sqlite3_session_backend::clean_up()
 {
+    // All statements must be finalized before closing the connection.
+    clear_statement_cache();
+
     sqlite3_close(conn_);
 }
 
+void sqlite3_session_backend::clear_statement_cache()
+{
+    for (statement_cache_list::iterator it = statementCache_.begin();
+         it != statementCache_.end(); ++it)
+    {
+        sqlite3_finalize(it->second);
+    }
+    statementCache_.clear();
+    statementCacheIndex_.clear();
+}
+
+sqlite3_stmt *
+sqlite3_session_backend::get_cached_statement(std::string const & query)
+{
+    std::map<std::string, statement_cache_list::iterator>::iterator const
+        it = statementCacheIndex_.find(query);
+    if (it == statementCacheIndex_.end())
+        return NULL;
+
+    sqlite3_stmt * const stmt = it->second->second;
+    statementCache_.erase(it->second);
+    statementCacheIndex_.erase(it);
+
+    // The statement was already reset when it was put into the cache, but
+    // it still has the values bound to it during its last execution.
+    sqlite3_clear_bindings(stmt);
+
+    return stmt;
+}
+
+void sqlite3_session_backend::release_statement(std::string const & query,
+                                                sqlite3_stmt * stmt)
+{
+    if (statementCacheSize_ == 0)
+    {
+        sqlite3_finalize(stmt);
+        return;
+    }
+
+    if (is_schema_changing_query(query))
+    {
+        sqlite3_finalize(stmt);
+        clear_statement_cache();
+        return;
+    }
+
+    // If another statement for the same query is already cached, just keep
+    // that one.
+    if (statementCacheIndex_.count(query))
+    {
+        sqlite3_finalize(stmt);
+        return;
+    }
+
+    // Reset the statement immediately, even if it is not going to be reused
+    // soon, as it may hold locks on the database while it is active.
+    sqlite3_reset(stmt);
+
+    statementCache_.push_front(std::make_pair(query, stmt));
+    statementCacheIndex_[query] = statementCache_.begin();
+
+    if (statementCache_.size() > statementCacheSize_)
+    {
+        sqlite3_finalize(statementCache_.back().second);
+        statementCacheIndex_.erase(statementCache_.back().first);
+        statementCache_.pop_back();
+    }
+}
+
 sqlite3_statement_backend * sqlite3_session_backend::make_statement_backend()
 {
     return new sqlite3_statement_backend(*this);
@@ -200,6 +200,11 @@ void sqlite3_standard_use_type_backend::pre_use(indicator const * ind)
             blob *b = static_cast<blob *>(data_);
             sqlite3_blob_backend *bbe = static_cast<sqlite3_blob_backend *>(b->get_backend());
 
+            if (bbe->is_open())
+            {
+                throw soci_error("BLOB opened for incremental I/O can't be used as a parameter.");
+            }
+
             // In case the internal buffer has not been initialized yet, get_buffer() will return nullptr. In this case,
             // we want to make sure to insert an empty BLOB into the DB. However, when passing a nullptr to the
             // sqlite3_bind_blob routine (in statement.cpp), it has the same effect as sqlite3_bind_null and thus
@@ -26,10 +26,80 @@ using namespace soci;
 using namespace soci::details;
 using namespace sqlite_api;
 
+namespace // anonymous
+{
+
+// Minimal size of a block allocated by sqlite3_column_arena.
+std::size_t const arenaBlockSize = 64*1024;
+
+// Execute one of the commands used for managing the implicit savepoint.
+void execute_savepoint_command(sqlite_api::sqlite3* conn, char const* query)
+{
+    char* zErrMsg = 0;
+    int const res = sqlite3_exec(conn, query, NULL, NULL, &zErrMsg);
+    if (res != SQLITE_OK)
+    {
+        std::ostringstream ss;
+        ss << "sqlite3_statement_backend::bind_and_execute: \"" << query
+           << "\" failed: " << (zErrMsg ? zErrMsg : sqlite3_errstr(res));
+        sqlite3_free(zErrMsg);
+
+        throw sqlite3_soci_error(ss.str(), res);
+    }
+}
+
+} // namespace anonymous
+
+char * sqlite3_column_arena::allocate(std::size_t size)
+{
+    if (current_ < blocks_.size() && blocks_[current_].size() - used_ < size)
+    {
+        // Try the next block, if any, as it may be big enough.
+        ++current_;
+        used_ = 0;
+        if (current_ < blocks_.size() && blocks_[current_].size() < size)
+        {
+            // Blocks following the current one are unused, so it's fine to
+            // just throw away the ones which are too small.
+            blocks_.resize(current_);
+        }
+    }
+
+    if (current_ == blocks_.size())
+    {
+        blocks_.push_back(std::vector<char>(std::max(size, arenaBlockSize)));
+        used_ = 0;
+    }
+
+    char * const p = &blocks_[current_][0] + used_;
+    used_ += size;
+    return p;
+}
+
+void sqlite3_column_arena::reset()
+{
+    // If more than one block was used, merge them into a single one big
+    // enough for everything, so that we don't need to allocate again when
+    // fetching the next batch of a similar size.
+    if (current_ > 0)
+    {
+        std::size_t total = 0;
+        for (std::size_t n = 0; n <= current_ && n < blocks_.size(); ++n)
+            total += blocks_[n].size();
+
+        blocks_.clear();
+        blocks_.push_back(std::vector<char>(total));
+    }
+
+    current_ = 0;
+    used_ = 0;
+}
+
 sqlite3_statement_backend::sqlite3_statement_backend(
     sqlite3_session_backend &session)
     : session_(session)
     , stmt_(0)
+    , pendingStep_(0)
     , dataCache_()
     , useData_(0)
     , databaseReady_(false)
@@ -49,9 +119,11 @@ void sqlite3_statement_backend::clean_up()
 {
     rowsAffectedBulk_ = -1LL;
 
+    pendingStep_ = 0;
+
     if (stmt_)
     {
-        sqlite3_finalize(stmt_);
+        session_.release_statement(query_, stmt_);
         stmt_ = 0;
         databaseReady_ = false;
     }
@@ -62,12 +134,35 @@ void sqlite3_statement_backend::prepare(std::string const & query,
 {
     clean_up();
 
+    query_ = query;
+
+    stmt_ = session_.get_cached_statement(query);
+    if (stmt_)
+    {
+        databaseReady_ = true;
+        return;
+    }
+
     char const* tail = 0; // unused;
+#if SQLITE_VERSION_NUMBER >= 3020000
+    // Let SQLite know that the statement is going to be reused if it's going
+    // to be cached.
+    unsigned int const prepFlags = session_.statementCacheSize_
+                                    ? SQLITE_PREPARE_PERSISTENT
+                                    : 0;
+    int const res = sqlite3_prepare_v3(session_.conn_,
+                              query.c_str(),
+                              static_cast<int>(query.size()),
+                              prepFlags,
+                              &stmt_,
+                              &tail);
+#else
     int const res = sqlite3_prepare_v2(session_.conn_,
                               query.c_str(),
                               static_cast<int>(query.size()),
                               &stmt_,
                               &tail);
+#endif
     if (res != SQLITE_OK)
     {
         char const* zErrMsg = sqlite3_errmsg(session_.conn_);
@@ -92,6 +187,8 @@ void sqlite3_statement_backend::reset_if_needed()
 
 void sqlite3_statement_backend::reset()
 {
+    pendingStep_ = 0;
+
     int const res = sqlite3_reset(stmt_);
     if (SQLITE_OK == res)
     {
@@ -99,6 +196,20 @@ void sqlite3_statement_backend::reset()
     }
 }
 
+// Advance to the next row, or return the result of the step already done by
+// describe_column(), if any.
+int sqlite3_statement_backend::step()
+{
+    if (pendingStep_)
+    {
+        int const res = pendingStep_;
+        pendingStep_ = 0;
+        return res;
+    }
+
+    return sqlite3_step(stmt_);
+}
+
 // This is used by bulk operations
 statement_backend::exec_fetch_result
 sqlite3_statement_backend::load_rowset(int totalRows)
@@ -127,6 +238,9 @@ sqlite3_statement_backend::load_rowset(int totalRows)
     }
     else
     {
+        // the buffers used by the previous batch are not needed any more
+        dataArena_.reset();
+
         // make the vector big enough to hold the data we need
         dataCache_.resize(totalRows);
         for (sqlite3_recordset::iterator it = dataCache_.begin(),
@@ -137,7 +251,7 @@ sqlite3_statement_backend::load_rowset(int totalRows)
 
         for (i = 0; i < totalRows && databaseReady_; ++i)
         {
-            int const res = sqlite3_step(stmt_);
+            int const res = step();
 
             if (SQLITE_DONE == res)
             {
@@ -167,7 +281,7 @@ sqlite3_statement_backend::load_rowset(int totalRows)
                         case db_string:
                         case db_date:
                             col.buffer_.size_ = sqlite3_column_bytes(stmt_, c);
-                            col.buffer_.data_ = new char[col.buffer_.size_+1];
+                            col.buffer_.data_ = dataArena_.allocate(col.buffer_.size_+1);
                             memcpy(col.buffer_.data_, sqlite3_column_text(stmt_, c), col.buffer_.size_+1);
                             break;
 
@@ -202,7 +316,7 @@ sqlite3_statement_backend::load_rowset(int totalRows)
 
                         case db_blob:
                             col.buffer_.size_ = sqlite3_column_bytes(stmt_, c);
-                            col.buffer_.data_ = (col.buffer_.size_ > 0 ? new char[col.buffer_.size_] : NULL);
+                            col.buffer_.data_ = (col.buffer_.size_ > 0 ? dataArena_.allocate(col.buffer_.size_) : NULL);
                             memcpy(col.buffer_.data_, sqlite3_column_blob(stmt_, c), col.buffer_.size_);
                             break;
 
@@ -235,7 +349,7 @@ sqlite3_statement_backend::load_one()
         return ef_no_data;
 
     statement_backend::exec_fetch_result retVal = ef_success;
-    int const res = sqlite3_step(stmt_);
+    int const res = step();
 
     if (SQLITE_DONE == res)
     {
@@ -257,26 +371,25 @@ sqlite3_statement_backend::load_one()
     return retVal;
 }
 
-// Execute statements once for every row of useData
+// Execute statements once for every row of the vector use elements
 statement_backend::exec_fetch_result
 sqlite3_statement_backend::bind_and_execute(int number)
 {
     statement_backend::exec_fetch_result retVal = ef_no_data;
 
-    long long rowsAffectedBulkTemp = 0;
-
     rowsAffectedBulk_ = -1;
 
-    int const rows = static_cast<int>(useData_.size());
-    for (int row = 0; row < rows; ++row)
-    {
-        sqlite3_reset(stmt_);
+    sqlite3_reset(stmt_);
 
+    // Single use elements don't change from row to row, so bind them just
+    // once as SQLite keeps the bindings when the statement is reset.
+    if (!useData_.empty())
+    {
         int const totalPositions = static_cast<int>(useData_[0].size());
         for (int pos = 1; pos <= totalPositions; ++pos)
         {
             int bindRes = SQLITE_OK;
-            const sqlite3_column &col = useData_[row][pos-1];
+            const sqlite3_column &col = useData_[0][pos-1];
             if (col.isNull_)
             {
                 bindRes = sqlite3_bind_null(stmt_, pos);
@@ -337,28 +450,80 @@ sqlite3_statement_backend::bind_and_execute(int number)
 
             if (SQLITE_OK != bindRes)
             {
-                // preserve the number of rows affected so far.
-                rowsAffectedBulk_ = rowsAffectedBulkTemp;
+                rowsAffectedBulk_ = 0;
                 throw sqlite3_soci_error("Failure to bind on bulk operations", bindRes);
             }
         }
+    }
+
+    // The core ensures that all vector use elements have the same size.
+    int const rows = vectorUses_.empty()
+                        ? 1
+                        : static_cast<int>(vectorUses_[0]->size());
+
+    // Handle the case where there are both into and use elements
+    // in the same query and one of the into binds to a vector object.
+    if (1 == rows && number != rows)
+    {
+        bind_vector_uses(0);
+        return load_rowset(number);
+    }
+
+    // Executing each row in its own implicit transaction would be very slow,
+    // as SQLite syncs the database to disk when committing each of them, so
+    // wrap all of them in a savepoint unless a transaction is already open.
+    bool const useSavepoint = rows > 1
+        && sqlite3_get_autocommit(session_.conn_) != 0
+        && sqlite3_stmt_readonly(stmt_) == 0;
+    if (useSavepoint)
+    {
+        execute_savepoint_command(session_.conn_, "SAVEPOINT soci_bulk");
+    }
+
+    long long rowsAffectedBulkTemp = 0;
+    try
+    {
+        for (int row = 0; row < rows; ++row)
+        {
+            sqlite3_reset(stmt_);
+            bind_vector_uses(row);
+
+            databaseReady_=true; // Mark sqlite engine is ready to perform sqlite3_step
+            retVal = load_one(); // execute each bound line
+            rowsAffectedBulkTemp += sqlite3_changes(session_.conn_);
+        }
+    }
+    catch (...)
+    {
+        // preserve the number of rows affected so far and keep the changes
+        // done by them, as it would happen without the savepoint.
+        rowsAffectedBulk_ = rowsAffectedBulkTemp;
 
-        // Handle the case where there are both into and use elements
-        // in the same query and one of the into binds to a vector object.
-        if (1 == rows && number != rows)
+        if (useSavepoint)
         {
-            return load_rowset(number);
+            sqlite3_exec(session_.conn_, "RELEASE soci_bulk", NULL, NULL, NULL);
         }
 
-        databaseReady_=true; // Mark sqlite engine is ready to perform sqlite3_step
-        retVal = load_one(); // execute each bound line
-        rowsAffectedBulkTemp += get_affected_rows();
+        throw;
+    }
+
+    if (useSavepoint)
+    {
+        execute_savepoint_command(session_.conn_, "RELEASE soci_bulk");
     }
 
     rowsAffectedBulk_ = rowsAffectedBulkTemp;
     return retVal;
 }
 
+void sqlite3_statement_backend::bind_vector_uses(int row)
+{
+    for (std::size_t n = 0; n != vectorUses_.size(); ++n)
+    {
+        vectorUses_[n]->bind_row(row);
+    }
+}
+
 statement_backend::exec_fetch_result
 sqlite3_statement_backend::execute(int number)
 {
@@ -367,12 +532,22 @@ sqlite3_statement_backend::execute(int number)
         throw soci_error("No sqlite statement created");
     }
 
+    // If the statement was already executed by describe_column() and there
+    // are no parameters that could have changed since then, just use the
+    // row it retrieved instead of executing it again.
+    if (pendingStep_ && useData_.empty() && vectorUses_.empty())
+    {
+        databaseReady_ = true;
+        return fetch(number);
+    }
+
+    pendingStep_ = 0;
     sqlite3_reset(stmt_);
     databaseReady_ = true;
 
     statement_backend::exec_fetch_result retVal = ef_no_data;
 
-    if (useData_.empty() == false)
+    if (useData_.empty() == false || vectorUses_.empty() == false)
     {
            retVal = bind_and_execute(number);
     }
@@ -559,8 +734,9 @@ void sqlite3_statement_backend::describe_column(int colNum,
     // try to get it from the weak ass type system
 
     // total hack - execute the statment once to get the column types
-    // then clear so it can be executed again
-    sqlite3_step(stmt_);
+    // from its first row, which is kept to be returned by the next fetch
+    if (!pendingStep_)
+        pendingStep_ = sqlite3_step(stmt_);
 
     int const sqlite3_type = sqlite3_column_type(stmt_, colNum-1);
     switch (sqlite3_type)
@@ -583,8 +759,6 @@ void sqlite3_statement_backend::describe_column(int colNum,
     }
     coldef.dataType_ = dbtype;
     coldef.type_ = to_data_type(dbtype);
-
-    sqlite3_reset(stmt_);
 }
 
 sqlite3_standard_into_type_backend *
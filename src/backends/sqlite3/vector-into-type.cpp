@@ -348,6 +348,27 @@ void sqlite3_vector_into_type_backend::post_fetch(bool gotData, indicator * ind)
                 break;
             } // x_xmltype
 
+            case x_binary:
+            {
+                switch (col.dataType_)
+                {
+                    case db_date:
+                    case db_string:
+                    case db_blob:
+                    {
+                        std::vector<uint8_t> &v =
+                            (*static_cast<std::vector<std::vector<uint8_t> >*>(data_))[i];
+                        uint8_t const * const p =
+                            reinterpret_cast<uint8_t const*>(col.buffer_.constData_);
+                        v.assign(p, p + col.buffer_.size_);
+                        break;
+                    }
+                    default:
+                        throw soci_error("DB type does not have a valid conversion to expected binary type");
+                };
+                break;
+            } // x_binary
+
             case x_int8:
                 set_number_in_vector<exchange_type_traits<x_int8>::value_type>(data_, i, col);
                 break;
@@ -420,31 +441,6 @@ void sqlite3_vector_into_type_backend::post_fetch(bool gotData, indicator * ind)
             default:
                 throw soci_error("Into element used with non-supported type.");
         }
-
-        // cleanup data
-        switch (col.dataType_)
-        {
-            case db_date:
-            case db_string:
-            case db_blob:
-                delete[] col.buffer_.data_;
-                col.buffer_.data_ = NULL;
-                break;
-
-            case db_double:
-            case db_int8:
-            case db_uint8:
-            case db_int16:
-            case db_uint16:
-            case db_int32:
-            case db_uint32:
-            case db_int64:
-            case db_uint64:
-                break;
-
-            case db_xml:
-                throw soci_error("XML data type is not supported");
-        }
     }
 }
 
@@ -495,6 +491,9 @@ void sqlite3_vector_into_type_backend::resize(std::size_t sz)
     case x_xmltype:
         resize_vector<soci::xml_type>(data_, sz);
         break;
+    case x_binary:
+        resize_vector<std::vector<uint8_t> >(data_, sz);
+        break;
     default:
         throw soci_error("Into vector element used with non-supported type.");
     }
@@ -548,6 +547,9 @@ std::size_t sqlite3_vector_into_type_backend::size()
     case x_xmltype:
         sz = get_vector_size<soci::xml_type>(data_);
         break;
+    case x_binary:
+        sz = get_vector_size<std::vector<uint8_t> >(data_);
+        break;
     default:
         throw soci_error("Into vector element used with non-supported type.");
     }
@@ -13,6 +13,7 @@
 #include "soci-mktime.h"
 #include "common.h"
 // std
+#include <algorithm>
 #include <cstdio>
 #include <cstdint>
 #include <cstdlib>
@@ -40,6 +41,7 @@ void sqlite3_vector_use_type_backend::bind_by_pos(int & position,
     position_ = position++;
 
     statement_.boundByPos_ = true;
+    statement_.vectorUses_.push_back(this);
 }
 
 void sqlite3_vector_use_type_backend::bind_by_name(std::string const & name,
@@ -66,128 +68,134 @@ void sqlite3_vector_use_type_backend::bind_by_name(std::string const & name,
         throw soci_error(ss.str());
     }
     statement_.boundByName_ = true;
+    statement_.vectorUses_.push_back(this);
 }
 
 void sqlite3_vector_use_type_backend::pre_use(indicator const * ind)
 {
-    std::size_t const vsize = size();
+    // The values are bound directly from the vector when executing the
+    // statement, see bind_row(), so just remember the indicators here.
+    ind_ = ind;
+}
 
-    // make sure that useData can hold enough rows
-    if (statement_.useData_.size() != vsize)
-        statement_.useData_.resize(vsize);
+namespace // anonymous
+{
 
-    int const pos = position_ - 1;
+template <exchange_type e>
+typename exchange_type_traits<e>::value_type const &
+get_vector_element(void *data, int row)
+{
+    typedef typename exchange_type_traits<e>::value_type value_type;
 
-    for (size_t i = 0; i != vsize; ++i)
-    {
-        // make sure that each row can accomodate the number of columns
-        if (statement_.useData_[i].size() < static_cast<std::size_t>(position_))
-            statement_.useData_[i].resize(position_);
+    return (*static_cast<std::vector<value_type> *>(data))[row];
+}
 
-        sqlite3_column &col = statement_.useData_[i][pos];
+} // namespace anonymous
 
-        // the data in vector can be either i_ok or i_null
-        if (ind != NULL && ind[i] == i_null)
-        {
-            col.isNull_ = true;
-            col.buffer_.data_ = NULL;
-            continue;
-        }
+void sqlite3_vector_use_type_backend::bind_row(int row)
+{
+    sqlite_api::sqlite3_stmt * const stmt = statement_.stmt_;
 
-        col.isNull_ = false;
+    int bindRes = SQLITE_OK;
 
+    // The values remain valid until the statement is executed, so there is
+    // no need to make SQLite copy them.
+    if (ind_ != NULL && ind_[row] == i_null)
+    {
+        bindRes = sqlite3_bind_null(stmt, position_);
+    }
+    else
+    {
         switch (type_)
         {
             case x_char:
-                col.type_ = dt_string;
-                col.dataType_ = db_string;
-                col.buffer_.constData_ = &(*static_cast<std::vector<exchange_type_traits<x_char>::value_type> *>(data_))[i];
-                col.buffer_.size_ = 1;
+                bindRes = sqlite3_bind_text(stmt, position_,
+                    &get_vector_element<x_char>(data_, row), 1, SQLITE_STATIC);
                 break;
 
             case x_stdstring:
             {
-                std::string &s = (*static_cast<std::vector<exchange_type_traits<x_stdstring>::value_type> *>(data_))[i];
-                col.type_ = dt_string;
-                col.dataType_ = db_string;
-                col.buffer_.constData_ = s.c_str();
-                col.buffer_.size_ = s.size();
+                std::string const &s = get_vector_element<x_stdstring>(data_, row);
+                bindRes = sqlite3_bind_text(stmt, position_,
+                    s.c_str(), static_cast<int>(s.size()), SQLITE_STATIC);
                 break;
             }
 
             case x_int8:
-                col.type_ = dt_integer;
-                col.dataType_ = db_int8;
-                col.int8_ = (*static_cast<std::vector<exchange_type_traits<x_int8>::value_type> *>(data_))[i];
+                bindRes = sqlite3_bind_int(stmt, position_,
+                    get_vector_element<x_int8>(data_, row));
                 break;
 
             case x_uint8:
-                col.type_ = dt_integer;
-                col.dataType_ = db_uint8;
-                col.uint8_ = (*static_cast<std::vector<exchange_type_traits<x_uint8>::value_type> *>(data_))[i];
+                bindRes = sqlite3_bind_int(stmt, position_,
+                    get_vector_element<x_uint8>(data_, row));
                 break;
 
             case x_int16:
-                col.type_ = dt_integer;
-                col.dataType_ = db_int16;
-                col.int16_ = (*static_cast<std::vector<exchange_type_traits<x_int16>::value_type> *>(data_))[i];
+                bindRes = sqlite3_bind_int(stmt, position_,
+                    get_vector_element<x_int16>(data_, row));
                 break;
 
             case x_uint16:
-                col.type_ = dt_integer;
-                col.dataType_ = db_uint16;
-                col.uint16_ = (*static_cast<std::vector<exchange_type_traits<x_uint16>::value_type> *>(data_))[i];
+                bindRes = sqlite3_bind_int(stmt, position_,
+                    get_vector_element<x_uint16>(data_, row));
                 break;
 
             case x_int32:
-                col.type_ = dt_integer;
-                col.dataType_ = db_int32;
-                col.int32_ = (*static_cast<std::vector<exchange_type_traits<x_int32>::value_type> *>(data_))[i];
+                bindRes = sqlite3_bind_int(stmt, position_,
+                    get_vector_element<x_int32>(data_, row));
                 break;
 
             case x_uint32:
-                col.type_ = dt_long_long;
-                col.dataType_ = db_uint32;
-                col.uint32_ = (*static_cast<std::vector<exchange_type_traits<x_uint32>::value_type> *>(data_))[i];
+                bindRes = sqlite3_bind_int64(stmt, position_,
+                    static_cast<sqlite_api::sqlite3_int64>(
+                        get_vector_element<x_uint32>(data_, row)));
                 break;
 
             case x_int64:
-                col.type_ = dt_long_long;
-                col.dataType_ = db_int64;
-                col.int64_ = (*static_cast<std::vector<exchange_type_traits<x_int64>::value_type> *>(data_))[i];
+                bindRes = sqlite3_bind_int64(stmt, position_,
+                    get_vector_element<x_int64>(data_, row));
                 break;
 
             case x_uint64:
-                col.type_ = dt_unsigned_long_long;
-                col.dataType_ = db_uint64;
-                col.uint64_ = (*static_cast<std::vector<exchange_type_traits<x_uint64>::value_type> *>(data_))[i];
+                bindRes = sqlite3_bind_int64(stmt, position_,
+                    static_cast<sqlite_api::sqlite3_int64>(
+                        get_vector_element<x_uint64>(data_, row)));
                 break;
 
             case x_double:
-                col.type_ = dt_double;
-                col.dataType_ = db_double;
-                col.double_ = (*static_cast<std::vector<exchange_type_traits<x_double>::value_type> *>(data_))[i];
+                bindRes = sqlite3_bind_double(stmt, position_,
+                    get_vector_element<x_double>(data_, row));
                 break;
 
             case x_stdtm:
             {
-                std::tm &tm = (*static_cast<std::vector<exchange_type_traits<x_stdtm>::value_type> *>(data_))[i];
-                static const size_t bufSize = 20;
-
-                col.type_ = dt_date;
-                col.dataType_ = db_date;
-                col.buffer_.data_ = new char[bufSize];
-                col.buffer_.size_ = format_std_tm(tm, col.buffer_.data_, bufSize);
+                int const len = format_std_tm(get_vector_element<x_stdtm>(data_, row),
+                    dateBuffer_, sizeof(dateBuffer_));
+                bindRes = sqlite3_bind_text(stmt, position_,
+                    dateBuffer_, len, SQLITE_STATIC);
                 break;
             }
 
             case x_xmltype:
             {
-                soci::xml_type &xml = (*static_cast<std::vector<exchange_type_traits<x_xmltype>::value_type> *>(data_))[i];
-                col.type_ = dt_string;
-                col.dataType_ = db_string;
-                col.buffer_.constData_ = xml.value.c_str();
-                col.buffer_.size_ = xml.value.size();
+                std::string const &s = get_vector_element<x_xmltype>(data_, row).value;
+                bindRes = sqlite3_bind_text(stmt, position_,
+                    s.c_str(), static_cast<int>(s.size()), SQLITE_STATIC);
+                break;
+            }
+
+            case x_binary:
+            {
+                std::vector<uint8_t> const &v = get_vector_element<x_binary>(data_, row);
+
+                // Binding a null pointer would result in binding NULL, so
+                // bind an empty value explicitly.
+                if (v.empty())
+                    bindRes = sqlite3_bind_zeroblob(stmt, position_, 0);
+                else
+                    bindRes = sqlite3_bind_blob(stmt, position_,
+                        &v[0], static_cast<int>(v.size()), SQLITE_STATIC);
                 break;
             }
 
@@ -196,6 +204,11 @@ void sqlite3_vector_use_type_backend::pre_use(indicator const * ind)
                     "Use vector element used with non-supported type.");
         }
     }
+
+    if (SQLITE_OK != bindRes)
+    {
+        throw sqlite3_soci_error("Failure to bind on bulk operations", bindRes);
+    }
 }
 
 std::size_t sqlite3_vector_use_type_backend::size()
@@ -243,6 +256,9 @@ std::size_t sqlite3_vector_use_type_backend::size()
     case x_xmltype:
         sz = get_vector_size<soci::xml_type>(data_);
         break;
+    case x_binary:
+        sz = get_vector_size<std::vector<uint8_t> >(data_);
+        break;
     default:
         throw soci_error("Use vector element used with non-supported type.");
     }
@@ -252,19 +268,6 @@ std::size_t sqlite3_vector_use_type_backend::size()
 
 void sqlite3_vector_use_type_backend::clean_up()
 {
-    if (type_ != x_stdtm)
-        return;
-
-    int const pos = position_ - 1;
-
-    for (sqlite3_recordset::iterator iter = statement_.useData_.begin(), last = statement_.useData_.end();
-        iter != last; ++iter)
-    {
-        sqlite3_column &col = (*iter)[pos];
-
-        if (col.isNull_)
-            continue;
-
-        delete[] col.buffer_.data_;
-    }
+    std::vector<sqlite3_vector_use_type_backend*> &uses = statement_.vectorUses_;
+    uses.erase(std::remove(uses.begin(), uses.end(), this), uses.end());
 }
@@ -0,0 +1,62 @@
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#define SOCI_SQLITE3_SOURCE
+#include "soci/sqlite3/wal-pool.h"
+#include "soci/session.h"
+
+using namespace soci;
+
+sqlite3_wal_pool::sqlite3_wal_pool(std::string const & connectString,
+                                   std::size_t readersCount)
+    : readersCount_(readersCount)
+    , writer_(1)
+    , readers_(readersCount)
+{
+    open(connection_parameters(*factory_sqlite3(), connectString));
+}
+
+sqlite3_wal_pool::sqlite3_wal_pool(connection_parameters const & parameters,
+                                   std::size_t readersCount)
+    : readersCount_(readersCount)
+    , writer_(1)
+    , readers_(readersCount)
+{
+    open(parameters);
+}
+
+void sqlite3_wal_pool::open(connection_parameters const & parameters)
+{
+    // The options specified in the connection string take precedence over
+    // the ones we set below, so check that they don't conflict with them.
+    connection_parameters allParams(parameters);
+    if (parameters.get_connect_string().find('=') != std::string::npos)
+    {
+        allParams.extract_options_from_space_separated_string();
+    }
+
+    std::string val;
+    if (allParams.get_option("readonly", val) ||
+            allParams.get_option("journal_mode", val))
+    {
+        throw soci_error("SQLite WAL pool connection parameters must not "
+                         "contain readonly or journal_mode options.");
+    }
+
+    // The writer must be opened first, as it may need to create the database
+    // and it also switches it to WAL mode, which can't be done by read-only
+    // connections, but is persistent and so will be used by them too.
+    connection_parameters writerParams(parameters);
+    writerParams.set_option("journal_mode", "wal");
+    writer_.at(0).open(writerParams);
+
+    connection_parameters readerParams(parameters);
+    readerParams.set_option("readonly", "1");
+    for (std::size_t i = 0; i != readersCount_; ++i)
+    {
+        readers_.at(i).open(readerParams);
+    }
+}
@@ -25,14 +25,15 @@ using namespace soci::details;
 statement_impl::statement_impl(session & s)
     : session_(s), refCount_(1), row_(0),
       fetchSize_(1), initialFetchSize_(1),
-      alreadyDescribed_(false)
+      alreadyDescribed_(false), asyncExecuting_(false), asyncNum_(0)
 {
     backEnd_ = s.make_statement_backend();
 }
 
 statement_impl::statement_impl(prepare_temp_type const & prep)
     : session_(prep.get_prepare_info()->session_),
-      refCount_(1), row_(0), fetchSize_(1), alreadyDescribed_(false)
+      refCount_(1), row_(0), fetchSize_(1), alreadyDescribed_(false),
+      asyncExecuting_(false), asyncNum_(0)
 {
     backEnd_ = session_.make_statement_backend();
 
@@ -266,100 +267,170 @@ bool statement_impl::execute(bool withDataExchange)
 {
     try
     {
-        initialFetchSize_ = intos_size();
-
-        if (intos_.empty() == false && initialFetchSize_ == 0)
+        if (asyncExecuting_)
         {
-            // this can happen only with into-vectors elements
-            // and is not allowed when calling execute
-            throw soci_error("Vectors of size 0 are not allowed.");
+            throw soci_error("Asynchronous execution still in progress.");
         }
 
-        fetchSize_ = initialFetchSize_;
-
-        // pre-use should be executed before inspecting the sizes of use
-        // elements, as they can be resized in type conversion routines
+        int const num = start_execution(withDataExchange);
 
-        pre_use();
-
-        std::size_t const bindSize = uses_size();
+        return finish_execution(backEnd_->execute(num), num);
+    }
+    catch (...)
+    {
+        rethrow_current_exception_with_context("executing");
+    }
+}
 
-        if (bindSize > 1 && fetchSize_ > 1)
+bool statement_impl::execute_async(bool withDataExchange, bool & gotData)
+{
+    try
+    {
+        if (asyncExecuting_)
         {
-            throw soci_error(
-                 "Bulk insert/update and bulk select not allowed in same query");
+            throw soci_error("Asynchronous execution already in progress.");
         }
 
-        // looks like a hack and it is - row description should happen
-        // *after* the use elements were completely prepared
-        // and *before* the into elements are touched, so that the row
-        // description process can inject more into elements for
-        // implicit data exchange
-        if (row_ != NULL && alreadyDescribed_ == false)
+        asyncNum_ = start_execution(withDataExchange);
+
+        return poll_execution(gotData);
+    }
+    catch (...)
+    {
+        rethrow_current_exception_with_context("executing");
+    }
+}
+
+bool statement_impl::poll_execute(bool & gotData)
+{
+    try
+    {
+        if (!asyncExecuting_)
         {
-            describe();
-            define_for_row();
+            throw soci_error("No asynchronous execution in progress.");
         }
 
-        int num = 0;
-        if (withDataExchange)
-        {
-            num = 1;
+        return poll_execution(gotData);
+    }
+    catch (...)
+    {
+        rethrow_current_exception_with_context("executing");
+    }
+}
 
-            pre_fetch();
+bool statement_impl::poll_execution(bool & gotData)
+{
+    // Consider that the execution is over if the backend throws, it can be
+    // started anew after this.
+    asyncExecuting_ = false;
 
-            if (static_cast<int>(fetchSize_) > num)
-            {
-                num = static_cast<int>(fetchSize_);
-            }
-            if (static_cast<int>(bindSize) > num)
-            {
-                num = static_cast<int>(bindSize);
-            }
-        }
+    statement_backend::exec_fetch_result const
+        res = backEnd_->execute_async(asyncNum_);
+    if (res == statement_backend::ef_still_executing)
+    {
+        asyncExecuting_ = true;
+        return false;
+    }
 
-        pre_exec(num);
+    gotData = finish_execution(res, asyncNum_);
+    return true;
+}
 
-        statement_backend::exec_fetch_result res = backEnd_->execute(num);
+int statement_impl::start_execution(bool withDataExchange)
+{
+    initialFetchSize_ = intos_size();
 
-        bool gotData = false;
+    if (intos_.empty() == false && initialFetchSize_ == 0)
+    {
+        // this can happen only with into-vectors elements
+        // and is not allowed when calling execute
+        throw soci_error("Vectors of size 0 are not allowed.");
+    }
 
-        if (res == statement_backend::ef_success)
-        {
-            // the "success" means that the statement executed correctly
-            // and for select statement this also means that some rows were read
+    fetchSize_ = initialFetchSize_;
 
-            if (num > 0)
-            {
-                gotData = true;
+    // pre-use should be executed before inspecting the sizes of use
+    // elements, as they can be resized in type conversion routines
 
-                // ensure into vectors have correct size
-                resize_intos(static_cast<std::size_t>(num));
-            }
+    pre_use();
+
+    std::size_t const bindSize = uses_size();
+
+    if (bindSize > 1 && fetchSize_ > 1)
+    {
+        throw soci_error(
+             "Bulk insert/update and bulk select not allowed in same query");
+    }
+
+    // looks like a hack and it is - row description should happen
+    // *after* the use elements were completely prepared
+    // and *before* the into elements are touched, so that the row
+    // description process can inject more into elements for
+    // implicit data exchange
+    if (row_ != NULL && alreadyDescribed_ == false)
+    {
+        describe();
+        define_for_row();
+    }
+
+    int num = 0;
+    if (withDataExchange)
+    {
+        num = 1;
+
+        pre_fetch();
+
+        if (static_cast<int>(fetchSize_) > num)
+        {
+            num = static_cast<int>(fetchSize_);
         }
-        else // res == ef_no_data
+        if (static_cast<int>(bindSize) > num)
         {
-            // the "no data" means that the end-of-rowset condition was hit
-            // but still some rows might have been read (the last bunch of rows)
-            // it can also mean that the statement did not produce any results
-
-            gotData = fetchSize_ > 1 ? resize_intos() : false;
+            num = static_cast<int>(bindSize);
         }
+    }
+
+    pre_exec(num);
+
+    return num;
+}
+
+bool statement_impl::finish_execution(statement_backend::exec_fetch_result res,
+                                      int num)
+{
+    bool gotData = false;
+
+    if (res == statement_backend::ef_success)
+    {
+        // the "success" means that the statement executed correctly
+        // and for select statement this also means that some rows were read
 
         if (num > 0)
         {
-            post_fetch(gotData, false);
-        }
+            gotData = true;
 
-        post_use(gotData);
+            // ensure into vectors have correct size
+            resize_intos(static_cast<std::size_t>(num));
+        }
+    }
+    else // res == ef_no_data
+    {
+        // the "no data" means that the end-of-rowset condition was hit
+        // but still some rows might have been read (the last bunch of rows)
+        // it can also mean that the statement did not produce any results
 
-        session_.set_got_data(gotData);
-        return gotData;
+        gotData = fetchSize_ > 1 ? resize_intos() : false;
     }
-    catch (...)
+
+    if (num > 0)
     {
-        rethrow_current_exception_with_context("executing");
+        post_fetch(gotData, false);
     }
+
+    post_use(gotData);
+
+    session_.set_got_data(gotData);
+    return gotData;
 }
 
 long long statement_impl::get_affected_rows()
@@ -374,10 +445,35 @@ long long statement_impl::get_affected_rows()
     }
 }
 
+void statement_impl::collect_bulk_errors(bool collect)
+{
+    if (!backEnd_->collect_bulk_errors(collect))
+    {
+        throw soci_error("Collecting bulk errors is not supported by this backend.");
+    }
+}
+
+std::vector<bulk_error> statement_impl::get_bulk_errors()
+{
+    try
+    {
+        return backEnd_->get_bulk_errors();
+    }
+    catch (...)
+    {
+        rethrow_current_exception_with_context("getting the bulk errors of");
+    }
+}
+
 bool statement_impl::fetch()
 {
     try
     {
+        if (asyncExecuting_)
+        {
+            throw soci_error("Asynchronous execution still in progress.");
+        }
+
         if (fetchSize_ == 0)
         {
             truncate_intos();
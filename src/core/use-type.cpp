@@ -124,6 +124,10 @@ void standard_use_type::dump_value(std::ostream& os) const
         case x_longstring:
             os << "<long string>";
             return;
+
+        case x_binary:
+            os << "<binary>";
+            return;
     }
 
     // This is normally unreachable, but avoid throwing from here as we're
@@ -393,3 +393,51 @@ TEST_CASE("DB2 test 3", "[db2]")
     sql<<"DROP TABLE DB2INST1.SOCI_TEST";
     sql.commit();
 }
+
+TEST_CASE("DB2 vector long data", "[db2][bulk]")
+{
+    soci::session sql(backEnd, connectString);
+
+    sql << "CREATE TABLE DB2INST1.SOCI_TEST (ID INTEGER, TXT CLOB(1M), BIN BLOB(1M))";
+
+    // Use values longer than the chunk used by SQLGetData() for retrieving
+    // the columns which are too big to be bound.
+    std::vector<int> ids;
+    std::vector<long_string> txts;
+    std::vector<std::vector<uint8_t> > bins;
+    for (int i = 0; i < 10; i++)
+    {
+        ids.push_back(i);
+
+        long_string txt;
+        txt.value.assign(1000 * i + 1, static_cast<char>('a' + i));
+        txts.push_back(txt);
+
+        std::vector<uint8_t> bin(3000 * i);
+        for (std::size_t j = 0; j != bin.size(); ++j)
+            bin[j] = static_cast<uint8_t>(j + i);
+        bins.push_back(bin);
+    }
+
+    sql << "insert into db2inst1.SOCI_TEST (id, txt, bin) values (:id, :txt, :bin)",
+        use(ids, "id"), use(txts, "txt"), use(bins, "bin");
+
+    std::vector<int> ids2(20);
+    std::vector<long_string> txts2(20);
+    std::vector<std::vector<uint8_t> > bins2(20);
+    sql << "select id, txt, bin from db2inst1.SOCI_TEST order by id",
+        into(ids2), into(txts2), into(bins2);
+
+    REQUIRE(ids2.size() == 10);
+    REQUIRE(txts2.size() == 10);
+    REQUIRE(bins2.size() == 10);
+    for (int i = 0; i < 10; i++)
+    {
+        CHECK(ids2[i] == i);
+        CHECK(txts2[i].value == txts[i].value);
+        CHECK(bins2[i] == bins[i]);
+    }
+
+    sql<<"DROP TABLE DB2INST1.SOCI_TEST";
+    sql.commit();
+}
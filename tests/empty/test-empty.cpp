@@ -11,7 +11,9 @@
 
 #include <catch.hpp>
 
+#include <cstddef>
 #include <string>
+#include <vector>
 
 using namespace soci;
 using namespace soci::tests;
@@ -137,6 +139,85 @@ TEST_CASE("Dummy test", "[empty]")
     }
 }
 
+struct PersonRow
+{
+    int32_t id;
+    char name[20];
+    long nameInd;
+    double weight;
+};
+
+TEST_CASE("Struct exchange", "[empty][struct]")
+{
+    struct_fields<PersonRow> fields;
+    fields.field(&PersonRow::id)
+          .field(&PersonRow::name, &PersonRow::nameInd)
+          .field(&PersonRow::weight);
+
+    std::vector<details::struct_field> const& f = fields.get();
+    REQUIRE(f.size() == 3);
+
+    CHECK(f[0].type_ == details::x_int32);
+    CHECK(f[0].offset_ == offsetof(PersonRow, id));
+    CHECK(f[0].size_ == sizeof(int32_t));
+    CHECK(f[0].indOffset_ == -1);
+
+    CHECK(f[1].type_ == details::x_char);
+    CHECK(f[1].offset_ == offsetof(PersonRow, name));
+    CHECK(f[1].size_ == 20);
+    CHECK(f[1].indOffset_ == static_cast<std::ptrdiff_t>(offsetof(PersonRow, nameInd)));
+    CHECK(f[1].indSize_ == sizeof(long));
+
+    CHECK(f[2].type_ == details::x_double);
+    CHECK(f[2].offset_ == offsetof(PersonRow, weight));
+
+    // This backend doesn't support row-wise binding.
+    soci::session sql(backEnd, connectString);
+
+    std::vector<PersonRow> rows(10);
+    CHECK_THROWS_WITH(
+        (sql << "select", into_struct(rows, fields)),
+        Catch::Contains("not supported by this backend")
+    );
+    CHECK_THROWS_WITH(
+        (sql << "insert", use_struct(rows, fields)),
+        Catch::Contains("not supported by this backend")
+    );
+}
+
+TEST_CASE("Asynchronous execution", "[empty][async]")
+{
+    soci::session sql(backEnd, connectString);
+
+    int i = 0;
+    statement st = (sql.prepare << "select", into(i));
+
+    // This backend doesn't support asynchronous execution, so the statement
+    // is just executed synchronously.
+    CHECK(st.execute_async(true));
+    CHECK(st.got_data());
+
+    CHECK_THROWS_WITH(st.poll_execute(),
+                      Catch::Contains("No asynchronous execution in progress"));
+}
+
+TEST_CASE("Bulk errors", "[empty][bulk]")
+{
+    soci::session sql(backEnd, connectString);
+
+    std::vector<int> numbers(10);
+    statement st = (sql.prepare << "insert", use(numbers));
+
+    // Disabling collecting the errors is always possible.
+    CHECK_NOTHROW(st.collect_bulk_errors(false));
+
+    CHECK_THROWS_WITH(st.collect_bulk_errors(),
+                      Catch::Contains("not supported by this backend"));
+
+    st.execute(true);
+    CHECK(st.get_bulk_errors().empty());
+}
+
 // Each test must define the test context class which implements the base class
 // pure virtual functions in a backend-specific way.
 //
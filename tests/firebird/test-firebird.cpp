@@ -503,6 +503,215 @@ TEST_CASE("Firebird bulk operations", "[firebird][bulk]")
     sql << "drop table test6";
 }
 
+TEST_CASE("Firebird bulk insert", "[firebird][bulk]")
+{
+    soci::session sql(backEnd, connectString);
+
+    try
+    {
+        sql << "drop table test6";
+    }
+    catch (soci_error const &)
+    {} // ignore if error
+
+    sql << "create table test6 (id integer not null primary key, "
+           "name varchar(20), val double precision)";
+    sql.commit();
+
+    sql.begin();
+
+    int const rowsToTest = 1000;
+    std::vector<int> ids;
+    std::vector<std::string> names;
+    std::vector<double> vals;
+    std::vector<indicator> inds;
+    for (int i = 0; i != rowsToTest; ++i)
+    {
+        ids.push_back(i);
+
+        std::ostringstream ss;
+        ss << "name #" << i;
+        names.push_back(ss.str());
+
+        vals.push_back(i + 0.5);
+        inds.push_back(i % 10 == 0 ? i_null : i_ok);
+    }
+
+    statement st = (sql.prepare <<
+        "insert into test6(id, name, val) values(:id, :name, :val)",
+        use(ids), use(names), use(vals, inds));
+    st.execute(true);
+    CHECK(st.get_affected_rows() == rowsToTest);
+
+    int count = 0;
+    sql << "select count(*) from test6", into(count);
+    CHECK(count == rowsToTest);
+
+    sql << "select count(*) from test6 where val is null", into(count);
+    CHECK(count == rowsToTest / 10);
+
+    std::string name;
+    double val = 0;
+    sql << "select name, val from test6 where id = 123", into(name), into(val);
+    CHECK(name == "name #123");
+    CHECK(val == 123.5);
+
+    // Inserting duplicate keys must fail, but insert the rows before them.
+    std::vector<int> ids2;
+    ids2.push_back(rowsToTest);
+    ids2.push_back(rowsToTest + 1);
+    ids2.push_back(0);
+    ids2.push_back(rowsToTest + 2);
+
+    statement st2 = (sql.prepare << "insert into test6(id) values(:id)",
+                     use(ids2));
+    CHECK_THROWS_AS(st2.execute(true), firebird_soci_error);
+    CHECK(st2.get_affected_rows() == 2);
+
+    sql << "select count(*) from test6", into(count);
+    CHECK(count == rowsToTest + 2);
+
+    sql.commit();
+
+    sql << "drop table test6";
+}
+
+TEST_CASE("Firebird bulk fetch", "[firebird][bulk]")
+{
+    soci::session sql(backEnd, connectString);
+
+    try
+    {
+        sql << "drop table test6";
+    }
+    catch (soci_error const &)
+    {} // ignore if error
+
+    sql << "create table test6 (sh smallint, bi bigint, d double precision, "
+           "n numeric(10,2), ts timestamp, dt date, tm time)";
+    sql.commit();
+
+    sql.begin();
+
+    int const rowsToTest = 100;
+    for (int i = 0; i != rowsToTest; ++i)
+    {
+        long long const bi = i * 100000000LL;
+        double const d = i + 0.25;
+        double const n = i + 0.5;
+        sql << "insert into test6(sh, bi, d, n, ts, dt, tm) values(:sh, :bi, "
+               ":d, :n, '2020-01-02 03:04:05', '2020-01-02', '03:04:05')",
+            use(i), use(bi), use(d), use(n);
+    }
+
+    // Use vectors of the types different from the column types to check
+    // that the values are converted.
+    std::vector<int> sh(7);
+    std::vector<long long> bi(7);
+    std::vector<int> d(7);
+    std::vector<double> n(7);
+    std::vector<std::tm> ts(7), dt(7), tm(7);
+    std::vector<indicator> shInd(7);
+    statement st = (sql.prepare <<
+        "select case when mod(sh, 10) = 0 then null else sh end, "
+        "bi, d, n, ts, dt, tm from test6 order by sh",
+        into(sh, shInd), into(bi), into(d), into(n),
+        into(ts), into(dt), into(tm));
+    st.execute();
+
+    int i = 0;
+    while (st.fetch())
+    {
+        for (std::size_t j = 0; j != sh.size(); ++j, ++i)
+        {
+            if (i % 10 == 0)
+            {
+                CHECK(shInd[j] == i_null);
+            }
+            else
+            {
+                CHECK(shInd[j] == i_ok);
+                CHECK(sh[j] == i);
+            }
+
+            CHECK(bi[j] == i * 100000000LL);
+            CHECK(d[j] == i);
+            CHECK(n[j] == i + 0.5);
+
+            CHECK(ts[j].tm_year == 120);
+            CHECK(ts[j].tm_mon == 0);
+            CHECK(ts[j].tm_mday == 2);
+            CHECK(ts[j].tm_hour == 3);
+            CHECK(ts[j].tm_min == 4);
+            CHECK(ts[j].tm_sec == 5);
+
+            CHECK(dt[j].tm_year == 120);
+            CHECK(dt[j].tm_mday == 2);
+            CHECK(dt[j].tm_hour == 0);
+
+            CHECK(tm[j].tm_hour == 3);
+            CHECK(tm[j].tm_sec == 5);
+        }
+    }
+
+    CHECK(i == rowsToTest);
+
+    // Scaled values can't be fetched into integers.
+    std::vector<int> nInt(10);
+    CHECK_THROWS_AS((sql << "select n from test6", into(nInt)), soci_error);
+
+    sql.commit();
+
+    sql << "drop table test6";
+}
+
+TEST_CASE("Firebird binary vector", "[firebird][binary][vector]")
+{
+    soci::session sql(backEnd, connectString);
+
+    try
+    {
+        sql << "drop table test6b";
+    }
+    catch (soci_error const &)
+    {} // ignore if error
+
+    // Binary values can be stored both in BLOBs and in OCTETS strings.
+    sql << "create table test6b (id integer, b blob sub_type binary, "
+           "o varchar(50) character set octets)";
+    sql.commit();
+
+    sql.begin();
+
+    std::vector<int> ids;
+    std::vector<std::vector<uint8_t>> blobs, octets;
+    for (int i = 0; i != 10; ++i)
+    {
+        ids.push_back(i);
+        blobs.push_back(std::vector<uint8_t>(1000*i, static_cast<uint8_t>(i)));
+        octets.push_back(std::vector<uint8_t>(5*i, static_cast<uint8_t>(255 - i)));
+    }
+
+    sql << "insert into test6b(id, b, o) values(:id, :b, :o)",
+        use(ids), use(blobs), use(octets);
+
+    std::vector<std::vector<uint8_t>> blobsOut(10), octetsOut(10);
+    sql << "select b, o from test6b order by id",
+        into(blobsOut), into(octetsOut);
+
+    CHECK(blobsOut == blobs);
+    CHECK(octetsOut == octets);
+
+    // Values too long for the column are rejected.
+    std::vector<std::vector<uint8_t>> tooLong(1, std::vector<uint8_t>(51));
+    CHECK_THROWS_AS((sql << "insert into test6b(o) values(:o)", use(tooLong)),
+                    soci_error);
+
+    sql.commit();
+
+    sql << "drop table test6b";
+}
+
 // named parameters
 TEST_CASE("Firebird named parameters", "[firebird][named-params]")
 {
@@ -1086,6 +1086,316 @@ TEST_CASE("Cross-schema metadata", "[mysql][cross-schema]")
 }
 
 
+struct prepared_table_creator : table_creator_base
+{
+    prepared_table_creator(soci::session & sql)
+        : table_creator_base(sql)
+    {
+        sql << "create table soci_test(id integer, u bigint unsigned, "
+            "d double, n decimal(10, 2), s varchar(20), t text, "
+            "dt datetime)";
+    }
+};
+
+TEST_CASE("MySQL prepared statements", "[mysql][prepared]")
+{
+    soci::session sql(backEnd, connectString + " prepared=1");
+    prepared_table_creator tableCreator(sql);
+
+    std::vector<int> ids;
+    std::vector<std::string> strings;
+    std::vector<indicator> inds;
+    for (int i = 0; i != 10; ++i)
+    {
+        ids.push_back(i);
+        strings.push_back(std::string(static_cast<std::size_t>(i), 'x'));
+        inds.push_back(i % 2 ? i_ok : i_null);
+    }
+
+    statement ins = (sql.prepare <<
+        "insert into soci_test(id, s) values(:id, :s)",
+        use(ids, "id"), use(strings, inds, "s"));
+    ins.execute(true);
+    CHECK(ins.get_affected_rows() == 10);
+
+    // Check that the statement can be executed many times after preparing it
+    // only once.
+    int id = 0;
+    std::string s;
+    indicator ind = i_ok;
+    statement st = (sql.prepare <<
+        "select s from soci_test where id = :id", use(id), into(s, ind));
+    for (id = 0; id != 10; ++id)
+    {
+        st.execute(true);
+        if (id % 2)
+        {
+            CHECK(ind == i_ok);
+            CHECK(s == std::string(static_cast<std::size_t>(id), 'x'));
+        }
+        else
+        {
+            CHECK(ind == i_null);
+        }
+    }
+
+    std::vector<int> idsOut(4);
+    std::vector<std::string> stringsOut(4);
+    std::vector<indicator> indsOut(4);
+    statement st2 = (sql.prepare <<
+        "select id, s from soci_test order by id",
+        into(idsOut), into(stringsOut, indsOut));
+    st2.execute();
+    int count = 0;
+    while (st2.fetch())
+    {
+        for (std::size_t i = 0; i != idsOut.size(); ++i, ++count)
+        {
+            CHECK(idsOut[i] == count);
+            if (count % 2)
+            {
+                CHECK(indsOut[i] == i_ok);
+                CHECK(stringsOut[i] == strings[static_cast<std::size_t>(count)]);
+            }
+            else
+            {
+                CHECK(indsOut[i] == i_null);
+            }
+        }
+    }
+    CHECK(count == 10);
+
+    // Check the conversions of the other types too.
+    sql << "delete from soci_test";
+
+    unsigned long long u = 18446744073709551615ULL;
+    double d = 3.25;
+    std::string text(1000, 'y');
+    std::tm dt = std::tm();
+    dt.tm_year = 123;
+    dt.tm_mon = 4;
+    dt.tm_mday = 6;
+    dt.tm_hour = 7;
+    dt.tm_min = 8;
+    dt.tm_sec = 9;
+    sql << "insert into soci_test(id, u, d, n, t, dt) "
+           "values(1, :u, :d, 12.5, :t, :dt)",
+        use(u), use(d), use(text), use(dt);
+
+    unsigned long long u2 = 0;
+    double d2 = 0, n2 = 0;
+    std::string text2;
+    std::tm dt2 = std::tm();
+    sql << "select u, d, n, t, dt from soci_test",
+        into(u2), into(d2), into(n2), into(text2), into(dt2);
+    CHECK(u2 == u);
+    CHECK(d2 == d);
+    CHECK(n2 == 12.5);
+    CHECK(text2 == text);
+    CHECK(dt2.tm_year == 123);
+    CHECK(dt2.tm_mon == 4);
+    CHECK(dt2.tm_mday == 6);
+    CHECK(dt2.tm_hour == 7);
+    CHECK(dt2.tm_min == 8);
+    CHECK(dt2.tm_sec == 9);
+
+    row r;
+    sql << "select id, n, t from soci_test", into(r);
+    REQUIRE(r.size() == 3);
+    CHECK(r.get<int>(0) == 1);
+    CHECK(r.get<double>(1) == 12.5);
+    CHECK(r.get<std::string>(2) == text);
+}
+
+
+TEST_CASE("MySQL streaming results", "[mysql][streaming]")
+{
+    soci::session sql(backEnd, connectString + " streaming=1");
+    integer_value_table_creator tableCreator(sql);
+
+    std::vector<int> values;
+    for (int i = 0; i != 100; ++i)
+    {
+        values.push_back(i);
+    }
+    sql << "insert into soci_test(val) values(:val)", use(values);
+
+    // Fetch the rows in batches not dividing the total number of rows.
+    std::vector<int> batch(7);
+    statement st = (sql.prepare << "select val from soci_test order by val",
+        into(batch));
+    st.execute();
+    int count = 0;
+    while (st.fetch())
+    {
+        for (std::size_t i = 0; i != batch.size(); ++i, ++count)
+        {
+            CHECK(batch[i] == count);
+        }
+    }
+    CHECK(count == 100);
+
+    // Check that describing the columns doesn't lose the first row.
+    row r;
+    statement st2 = (sql.prepare << "select val from soci_test order by val",
+        into(r));
+    st2.execute();
+    count = 0;
+    while (st2.fetch())
+    {
+        CHECK(r.get<int>(0) == count);
+        ++count;
+    }
+    CHECK(count == 100);
+
+    // Check that the remaining rows are discarded if not all of them are
+    // read, allowing to execute other statements.
+    int val = -1;
+    sql << "select val from soci_test order by val", into(val);
+    CHECK(val == 0);
+
+    int total = 0;
+    sql << "select count(*) from soci_test", into(total);
+    CHECK(total == 100);
+}
+
+
+TEST_CASE("MySQL multi-row bulk insert", "[mysql][bulk]")
+{
+    soci::session sql(backEnd, connectString);
+    strings_table_creator tableCreator(sql);
+
+    // Insert about 3MB of data, which is split into several statements if
+    // max_allowed_packet is smaller than this.
+    std::size_t const numRows = 3000;
+    std::vector<std::string> values;
+    for (std::size_t i = 0; i != numRows; ++i)
+    {
+        std::ostringstream oss;
+        oss << "value 'number' " << i << std::string(1000, '.');
+        values.push_back(oss.str());
+    }
+
+    statement st = (sql.prepare <<
+        "insert into soci_test(s5, e1) values(:s, 'foo')", use(values));
+    st.execute(true);
+    CHECK(st.get_affected_rows() == static_cast<long long>(numRows));
+
+    int count = 0;
+    sql << "select count(*) from soci_test where e1 = 'foo'", into(count);
+    CHECK(count == static_cast<int>(numRows));
+
+    std::string last;
+    sql << "select s5 from soci_test where s5 like 'value ''number'' 2999.%'",
+        into(last);
+    CHECK(last == values.back());
+
+    // Check that the statements which can't be rewritten still work.
+    std::vector<std::string> names(2, "bar");
+    statement st2 = (sql.prepare <<
+        "insert into soci_test(s5, e1) values(:s, 'baz'), ('single', 'baz')",
+        use(names));
+    st2.execute(true);
+    CHECK(st2.get_affected_rows() == 4);
+
+    sql << "select count(*) from soci_test where e1 = 'baz'", into(count);
+    CHECK(count == 4);
+}
+
+TEST_CASE("MySQL binary vector", "[mysql][binary][vector]")
+{
+    // Check both the text protocol and the prepared statements.
+    std::string const options[] = { "", " prepared=1" };
+    for (std::string const& opt : options)
+    {
+        soci::session sql(backEnd, connectString + opt);
+
+        struct blob_table_creator : public table_creator_base
+        {
+            blob_table_creator(soci::session & sql)
+                : table_creator_base(sql)
+            {
+                sql << "create table soci_test(id integer, val blob)";
+            }
+        } tableCreator(sql);
+
+        // Use all possible byte values, including NUL and quotes.
+        std::vector<int> ids;
+        std::vector<std::vector<uint8_t>> values;
+        for (int i = 0; i != 5; ++i)
+        {
+            std::vector<uint8_t> value;
+            for (int j = 0; j != 256*i; ++j)
+                value.push_back(static_cast<uint8_t>(j));
+            ids.push_back(i);
+            values.push_back(value);
+        }
+
+        sql << "insert into soci_test(id, val) values(:id, :val)",
+            use(ids), use(values);
+
+        std::vector<std::vector<uint8_t>> valuesOut(10);
+        sql << "select val from soci_test order by id", into(valuesOut);
+
+        CHECK(valuesOut == values);
+    }
+}
+
+
+TEST_CASE("MySQL load data", "[mysql][load-data]")
+{
+    soci::session sql(backEnd, connectString + " local_infile=1");
+
+    int localInfile = 0;
+    sql << "select @@local_infile", into(localInfile);
+    if (!localInfile)
+    {
+        WARN("Loading local data is disabled on the server, skipping test.");
+        return;
+    }
+
+    prepared_table_creator tableCreator(sql);
+
+    std::vector<int> ids;
+    std::vector<double> doubles;
+    std::vector<std::string> strings;
+    std::vector<indicator> inds;
+    for (int i = 0; i != 10000; ++i)
+    {
+        ids.push_back(i);
+        doubles.push_back(i + 0.5);
+        strings.push_back(i % 3 ? "tab\there\nand \\ backslash" : "");
+        inds.push_back(i % 7 ? i_ok : i_null);
+    }
+
+    mysql_data_loader loader("soci_test");
+    loader.column("id", ids).column("d", doubles).column("s", strings, inds);
+
+    mysql_session_backend *sessionBackEnd
+        = static_cast<mysql_session_backend *>(sql.get_backend());
+    mysql_load_data_result const res = sessionBackEnd->load_data(loader);
+    CHECK(res.rows_ == 10000);
+    CHECK(res.warnings_ == 0);
+
+    int count = 0;
+    sql << "select count(*) from soci_test where s is null", into(count);
+    CHECK(count == 1429);
+
+    std::string s;
+    double d = 0;
+    sql << "select d, s from soci_test where id = 1", into(d), into(s);
+    CHECK(d == 1.5);
+    CHECK(s == strings[1]);
+
+    sql << "select s from soci_test where id = 3", into(s);
+    CHECK(s.empty());
+
+    // Vectors of different sizes are not allowed.
+    ids.pop_back();
+    CHECK_THROWS_AS(sessionBackEnd->load_data(loader), soci_error);
+}
+
+
 std::string escape_string(soci::session& sql, const std::string& s)
 {
     mysql_session_backend* backend = static_cast<mysql_session_backend*>(
@@ -12,6 +12,8 @@
 #include <string>
 #include <ctime>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
 
 #include <catch.hpp>
 
@@ -77,6 +79,324 @@ TEST_CASE("MS SQL long string", "[odbc][mssql][long]")
     );
 }
 
+TEST_CASE("MS SQL long string vector", "[odbc][mssql][long][vector]")
+{
+    soci::session sql(backEnd, connectString);
+
+    struct long_text_table_creator : public table_creator_base
+    {
+        explicit long_text_table_creator(soci::session& sql)
+            : table_creator_base(sql)
+        {
+            sql << "create table soci_test ("
+                        "id integer not null, "
+                        "long_text nvarchar(max) null, "
+                        "val integer null"
+                    ")";
+        }
+    } long_text_table_creator(sql);
+
+    // Use strings longer than the initial chunk used for retrieving them and
+    // values in the column following the long one to check that they are
+    // all retrieved correctly when fetching several rows at once.
+    int const count = 10;
+    std::vector<int> ids;
+    std::vector<std::string> texts;
+    std::vector<int> vals;
+    for (int i = 0; i < count; ++i)
+    {
+        ids.push_back(i);
+        texts.push_back(std::string(1000*(i + 1), static_cast<char>('a' + i)));
+        vals.push_back(i*i);
+    }
+
+    sql << "insert into soci_test(id, long_text, val) values(:id, :str, :val)",
+        use(ids), use(texts), use(vals);
+
+    std::vector<int> idsOut(4);
+    std::vector<std::string> textsOut(4);
+    std::vector<int> valsOut(4);
+    statement st = (sql.prepare <<
+        "select id, long_text, val from soci_test order by id",
+        into(idsOut), into(textsOut), into(valsOut));
+    st.execute();
+
+    int n = 0;
+    while (st.fetch())
+    {
+        for (std::size_t i = 0; i != idsOut.size(); ++i, ++n)
+        {
+            CHECK(idsOut[i] == n);
+            CHECK(textsOut[i].length() == texts[n].length());
+            CHECK(textsOut[i] == texts[n]);
+            CHECK(valsOut[i] == vals[n]);
+        }
+    }
+
+    CHECK(n == count);
+}
+
+TEST_CASE("MS SQL binary vector", "[odbc][mssql][binary][vector]")
+{
+    soci::session sql(backEnd, connectString);
+
+    struct binary_table_creator : public table_creator_base
+    {
+        explicit binary_table_creator(soci::session& sql)
+            : table_creator_base(sql)
+        {
+            sql << "create table soci_test ("
+                        "id integer not null, "
+                        "short_bin varbinary(100) null, "
+                        "long_bin varbinary(max) null"
+                    ")";
+        }
+    } binary_table_creator(sql);
+
+    // The first column is bound to a fixed size buffer while the second one
+    // is retrieved in chunks, check that both work, including for the values
+    // with embedded NULs and longer than the chunk size.
+    int const count = 10;
+    std::vector<int> ids;
+    std::vector<std::vector<uint8_t>> shortBins;
+    std::vector<std::vector<uint8_t>> longBins;
+    for (int i = 0; i < count; ++i)
+    {
+        ids.push_back(i);
+        shortBins.push_back(std::vector<uint8_t>(10*i, static_cast<uint8_t>(i)));
+        longBins.push_back(std::vector<uint8_t>(1000*i, static_cast<uint8_t>(255 - i)));
+    }
+
+    sql << "insert into soci_test(id, short_bin, long_bin) values(:id, :s, :l)",
+        use(ids), use(shortBins), use(longBins);
+
+    std::vector<int> idsOut(4);
+    std::vector<std::vector<uint8_t>> shortBinsOut(4);
+    std::vector<std::vector<uint8_t>> longBinsOut(4);
+    statement st = (sql.prepare <<
+        "select id, short_bin, long_bin from soci_test order by id",
+        into(idsOut), into(shortBinsOut), into(longBinsOut));
+    st.execute();
+
+    int n = 0;
+    while (st.fetch())
+    {
+        for (std::size_t i = 0; i != idsOut.size(); ++i, ++n)
+        {
+            CHECK(idsOut[i] == n);
+            CHECK(shortBinsOut[i] == shortBins[n]);
+            CHECK(longBinsOut[i].size() == longBins[n].size());
+            CHECK(longBinsOut[i] == longBins[n]);
+        }
+    }
+
+    CHECK(n == count);
+}
+
+namespace
+{
+
+struct person_row
+{
+    int32_t id;
+    char name[20];
+    SQLLEN nameInd;
+    double weight;
+};
+
+} // anonymous namespace
+
+TEST_CASE("MS SQL row-wise binding", "[odbc][mssql][struct]")
+{
+    soci::session sql(backEnd, connectString);
+
+    struct person_table_creator : public table_creator_base
+    {
+        explicit person_table_creator(soci::session& sql)
+            : table_creator_base(sql)
+        {
+            sql << "create table soci_test ("
+                        "id integer not null, "
+                        "name varchar(19) null, "
+                        "weight float not null"
+                    ")";
+        }
+    } person_table_creator(sql);
+
+    struct_fields<person_row> fields;
+    fields.field(&person_row::id)
+          .field(&person_row::name, &person_row::nameInd)
+          .field(&person_row::weight);
+
+    int const count = 10;
+    std::vector<person_row> in(count);
+    for (int i = 0; i < count; ++i)
+    {
+        in[i].id = i;
+        std::snprintf(in[i].name, sizeof(in[i].name), "person #%d", i);
+        in[i].nameInd = i % 3 == 0 ? SQL_NULL_DATA : SQL_NTS;
+        in[i].weight = 50.5 + i;
+    }
+
+    sql << "insert into soci_test(id, name, weight) values(?, ?, ?)",
+        use_struct(in, fields);
+
+    int n = 0;
+    sql << "select count(*) from soci_test", into(n);
+    CHECK(n == count);
+
+    std::vector<person_row> out(4);
+    statement st = (sql.prepare <<
+        "select id, name, weight from soci_test order by id",
+        into_struct(out, fields));
+    st.execute();
+
+    n = 0;
+    while (st.fetch())
+    {
+        for (std::size_t i = 0; i != out.size(); ++i, ++n)
+        {
+            CHECK(out[i].id == n);
+            if (n % 3 == 0)
+            {
+                CHECK(out[i].nameInd == SQL_NULL_DATA);
+            }
+            else
+            {
+                CHECK(out[i].nameInd == static_cast<SQLLEN>(std::strlen(in[n].name)));
+                CHECK(std::string(out[i].name) == in[n].name);
+            }
+            CHECK(out[i].weight == in[n].weight);
+        }
+    }
+
+    CHECK(n == count);
+}
+
+TEST_CASE("MS SQL statement handles reuse", "[odbc][mssql][cache]")
+{
+    soci::session sql(backEnd, connectString);
+
+    struct val_table_creator : public table_creator_base
+    {
+        explicit val_table_creator(soci::session& sql)
+            : table_creator_base(sql)
+        {
+            sql << "create table soci_test(val integer)";
+        }
+    } val_table_creator(sql);
+
+    SQLHSTMT hstmt;
+    {
+        statement st = (sql.prepare << "insert into soci_test(val) values(1)");
+        st.execute(true);
+        hstmt = static_cast<odbc_statement_backend*>(st.get_backend())->hstmt_;
+    }
+
+    // Without the statement cache, the handle of the destroyed statement must
+    // be reused by the next one, even if it is for a different query.
+    int val = 0;
+    {
+        statement st = (sql.prepare << "select val from soci_test", into(val));
+        CHECK(static_cast<odbc_statement_backend*>(st.get_backend())->hstmt_ == hstmt);
+        st.execute(true);
+        CHECK(val == 1);
+    }
+}
+
+TEST_CASE("MS SQL prepared statements cache", "[odbc][mssql][cache]")
+{
+    connection_parameters params(backEnd, connectString);
+    params.set_option(odbc_option_statement_cache, "4");
+    soci::session sql(params);
+
+    struct val_table_creator : public table_creator_base
+    {
+        explicit val_table_creator(soci::session& sql)
+            : table_creator_base(sql)
+        {
+            sql << "create table soci_test(val integer)";
+        }
+    } val_table_creator(sql);
+
+    // Preparing the same query again must reuse the already prepared handle.
+    SQLHSTMT hstmt;
+    int i = 1;
+    {
+        statement st = (sql.prepare << "insert into soci_test(val) values(:val)", use(i));
+        st.execute(true);
+        hstmt = static_cast<odbc_statement_backend*>(st.get_backend())->hstmt_;
+    }
+
+    i = 2;
+    {
+        statement st = (sql.prepare << "insert into soci_test(val) values(:val)", use(i));
+        CHECK(static_cast<odbc_statement_backend*>(st.get_backend())->hstmt_ == hstmt);
+        st.execute(true);
+    }
+
+    // Executing the same queries repeatedly must work whether the prepared
+    // statements are reused or not.
+    for (i = 3; i <= 5; ++i)
+    {
+        sql << "insert into soci_test(val) values(:val)", use(i);
+
+        int count = 0;
+        sql << "select count(*) from soci_test", into(count);
+        CHECK(count == i);
+    }
+
+    int val = 0;
+    sql << "select max(val) from soci_test", into(val);
+    CHECK(val == 5);
+}
+
+TEST_CASE("MS SQL asynchronous execution", "[odbc][mssql][async]")
+{
+    soci::session sql(backEnd, connectString);
+
+    struct val_table_creator : public table_creator_base
+    {
+        explicit val_table_creator(soci::session& sql)
+            : table_creator_base(sql)
+        {
+            sql << "create table soci_test(val integer)";
+        }
+    } val_table_creator(sql);
+
+    std::vector<int> vals;
+    for (int i = 0; i < 100; ++i)
+        vals.push_back(i);
+
+    statement ins = (sql.prepare << "insert into soci_test(val) values(:val)",
+                     use(vals));
+    if (!ins.execute_async(true))
+    {
+        while (!ins.poll_execute())
+            ;
+    }
+    CHECK(ins.get_affected_rows() == 100);
+
+    int sum = 0;
+    statement st = (sql.prepare << "select sum(val) from soci_test", into(sum));
+    if (!st.execute_async(true))
+    {
+        // Nothing else can be done with the statement while it's executing.
+        CHECK_THROWS_AS(st.fetch(), soci_error);
+
+        while (!st.poll_execute())
+            ;
+    }
+
+    CHECK(st.got_data());
+    CHECK(sum == 4950);
+
+    // Executing the statement synchronously must still work after this.
+    sum = 0;
+    st.execute(true);
+    CHECK(sum == 4950);
+}
+
 // DDL Creation objects for common tests
 struct table_creator_one : public table_creator_base
 {
@@ -1407,6 +1407,220 @@ TEST_CASE("Bulk iterators", "[oracle][bulkiters]")
     sql << "drop table t";
 }
 
+TEST_CASE("Oracle statement cache", "[oracle][cache]")
+{
+    soci::session sql(backEnd, connectString + " stmt_cache_size=10");
+
+    oracle_session_backend* const sessionBackend =
+        static_cast<oracle_session_backend*>(sql.get_backend());
+    CHECK(sessionBackend->get_statement_cache_size() == 10);
+
+    longlong_table_creator tableCreator(sql);
+
+    // The handle of the statement released to the cache must be reused when
+    // preparing the same query again.
+    OCIStmt* stmtp;
+    {
+        statement st = (sql.prepare << "select count(*) from soci_test");
+        stmtp = static_cast<oracle_statement_backend*>(st.get_backend())->stmtp_;
+    }
+    {
+        statement st = (sql.prepare << "select count(*) from soci_test");
+        CHECK(static_cast<oracle_statement_backend*>(st.get_backend())->stmtp_ == stmtp);
+    }
+
+    for (long long i = 1; i <= 5; ++i)
+    {
+        sql << "insert into soci_test(val) values(:val)", use(i);
+
+        long long count = 0;
+        sql << "select count(*) from soci_test", into(count);
+        CHECK(count == i);
+    }
+
+    // Errors must still be reported correctly and not break the cache.
+    CHECK_THROWS_AS((sql << "select nosuchcolumn from soci_test"), oracle_soci_error);
+    CHECK_THROWS_AS((sql << "select nosuchcolumn from soci_test"), oracle_soci_error);
+
+    long long total = 0;
+    sql << "select sum(val) from soci_test", into(total);
+    CHECK(total == 15);
+
+    CHECK_THROWS_AS(soci::session(backEnd, connectString + " stmt_cache_size=many"),
+                    soci_error);
+}
+
+TEST_CASE("Oracle prefetch", "[oracle][prefetch]")
+{
+    soci::session sql(backEnd, connectString + " prefetch_rows=10 prefetch_memory=65536");
+
+    oracle_session_backend* const sessionBackend =
+        static_cast<oracle_session_backend*>(sql.get_backend());
+    CHECK(sessionBackend->get_prefetch_rows() == 10);
+    CHECK(sessionBackend->get_prefetch_memory() == 65536);
+
+    longlong_table_creator tableCreator(sql);
+
+    int const count = 1000;
+    std::vector<long long> vals;
+    for (int i = 0; i != count; ++i)
+        vals.push_back(i);
+    sql << "insert into soci_test(val) values(:val)", use(vals);
+
+    // Fetching the rows one by one must work whether they're prefetched or not.
+    long long val = 0;
+    statement st = (sql.prepare << "select val from soci_test order by val",
+                    into(val));
+
+    oracle_statement_backend* const stBackend =
+        static_cast<oracle_statement_backend*>(st.get_backend());
+    CHECK(stBackend->prefetchRows_ == 10);
+
+    st.execute();
+    long long expected = 0;
+    while (st.fetch())
+    {
+        CHECK(val == expected);
+        ++expected;
+    }
+    CHECK(expected == count);
+
+    stBackend->set_prefetch_rows(0);
+    st.execute();
+    expected = 0;
+    while (st.fetch())
+    {
+        CHECK(val == expected);
+        ++expected;
+    }
+    CHECK(expected == count);
+
+    long long sum = 0;
+    rowset<long long> rs = (sql.prepare << "select val from soci_test");
+    for (rowset<long long>::const_iterator it = rs.begin(); it != rs.end(); ++it)
+    {
+        sum += *it;
+    }
+    CHECK(sum == count * (count - 1) / 2);
+}
+
+TEST_CASE("Oracle bulk errors", "[oracle][insert][bulk]")
+{
+    soci::session sql(backEnd, connectString);
+
+    struct pk_table_creator : table_creator_base
+    {
+        pk_table_creator(soci::session & sql)
+            : table_creator_base(sql)
+        {
+            sql << "create table soci_test(id number(10) primary key)";
+        }
+    } tableCreator(sql);
+
+    std::vector<int> ids;
+    for (int i = 0; i != 10; ++i)
+        ids.push_back(i);
+
+    // Make the rows 3 and 7 duplicates of the previous ones.
+    ids[3] = 2;
+    ids[7] = 6;
+
+    statement st = (sql.prepare << "insert into soci_test(id) values(:id)",
+                    use(ids));
+
+    // Without collecting errors, the execution stops at the first error.
+    CHECK_THROWS_AS(st.execute(true), oracle_soci_error);
+    CHECK(st.get_affected_rows() == 3);
+
+    sql << "delete from soci_test";
+
+    st.collect_bulk_errors();
+    st.execute(true);
+    CHECK(st.get_affected_rows() == 8);
+
+    std::vector<bulk_error> const errors = st.get_bulk_errors();
+    REQUIRE(errors.size() == 2);
+    CHECK(errors[0].row == 3);
+    CHECK(errors[0].code == 1); // ORA-00001: unique constraint violated
+    CHECK(!errors[0].message.empty());
+    CHECK(errors[1].row == 7);
+    CHECK(errors[1].code == 1);
+
+    int count = 0;
+    sql << "select count(*) from soci_test", into(count);
+    CHECK(count == 8);
+
+    // Successful execution must not leave any errors behind.
+    sql << "delete from soci_test";
+    ids[3] = 3;
+    ids[7] = 7;
+    st.execute(true);
+    CHECK(st.get_affected_rows() == 10);
+    CHECK(st.get_bulk_errors().empty());
+
+    // A bulk operation with a single row must collect its error too.
+    std::vector<int> one(1, 5);
+    statement st1 = (sql.prepare << "insert into soci_test(id) values(:id)",
+                     use(one));
+    st1.collect_bulk_errors();
+    st1.execute(true);
+    CHECK(st1.get_affected_rows() == 0);
+
+    std::vector<bulk_error> const errors1 = st1.get_bulk_errors();
+    REQUIRE(errors1.size() == 1);
+    CHECK(errors1[0].row == 0);
+    CHECK(errors1[0].code == 1);
+}
+
+TEST_CASE("Oracle binary vector", "[oracle][binary][vector]")
+{
+    soci::session sql(backEnd, connectString);
+
+    struct raw_table_creator : table_creator_base
+    {
+        raw_table_creator(soci::session & sql)
+            : table_creator_base(sql)
+        {
+            sql << "create table soci_test(id number(10), val raw(200))";
+        }
+    } tableCreator(sql);
+
+    std::vector<int> ids;
+    std::vector<std::vector<uint8_t>> values;
+    std::vector<indicator> inds;
+    for (int i = 0; i != 10; ++i)
+    {
+        ids.push_back(i);
+        values.push_back(std::vector<uint8_t>(20*i + 1, static_cast<uint8_t>(i)));
+        inds.push_back(i == 5 ? i_null : i_ok);
+    }
+    values[3][0] = 0;
+
+    sql << "insert into soci_test(id, val) values(:id, :val)",
+        use(ids), use(values, inds);
+
+    std::vector<int> idsOut(10);
+    std::vector<std::vector<uint8_t>> valuesOut(10);
+    std::vector<indicator> indsOut(10);
+    sql << "select id, val from soci_test order by id",
+        into(idsOut), into(valuesOut, indsOut);
+
+    REQUIRE(valuesOut.size() == 10);
+    for (int i = 0; i != 10; ++i)
+    {
+        CHECK(idsOut[i] == i);
+        if (i == 5)
+        {
+            CHECK(indsOut[i] == i_null);
+        }
+        else
+        {
+            CHECK(indsOut[i] == i_ok);
+            CHECK(valuesOut[i] == values[i]);
+        }
+    }
+}
+
 //
 // Support for soci Common Tests
 //
@@ -7,6 +7,7 @@
 
 #include "soci/soci.h"
 #include "soci/postgresql/soci-postgresql.h"
+#include "soci/postgresql/array-exchange.h"
 #include "test-context.h"
 #include "test-myint.h"
 #include <iostream>
@@ -609,6 +610,30 @@ TEST_CASE("PostgreSQL bytea", "[postgresql][bytea]")
     }
 }
 
+TEST_CASE("PostgreSQL vector bytea", "[postgresql][bytea][vector]")
+{
+    soci::session sql(backEnd, connectString);
+
+    bytea_table_creator tableCreator(sql);
+
+    // Unlike std::string, binary values are decoded from bytea format.
+    std::vector<std::vector<uint8_t>> in(1); // Start with an empty value.
+    for (int i = 0; i < 5; ++i)
+    {
+        std::vector<uint8_t> value;
+        for (int j = 0; j <= i*50; ++j)
+            value.push_back(static_cast<uint8_t>(255 - j));
+        in.push_back(value);
+    }
+
+    sql << "insert into soci_test(val) values(:val)", use(in);
+
+    std::vector<std::vector<uint8_t>> out(10);
+    sql << "select val from soci_test order by length(val)", into(out);
+
+    CHECK(out == in);
+}
+
 // json
 struct table_creator_json : public table_creator_base
 {
@@ -1281,6 +1306,35 @@ TEST_CASE("test_enum_with_explicit_custom_type_string_rowset", "[postgresql][bin
     CHECK(type_value==TestStringEnum::VALUE_STR_2);
 }
 
+TEST_CASE("PostgreSQL preloaded type categories", "[postgresql][row][enum]")
+{
+    soci::session sql(backEnd, connectString);
+    sql << "CREATE TYPE soci_test_mood AS ENUM ('sad', 'ok', 'happy')";
+
+    try
+    {
+        soci::session sql2(backEnd, connectString + " preloadtypes=true");
+
+        soci::row r;
+        sql2 << "select 'ok'::soci_test_mood as m", into(r);
+        REQUIRE(r.size() == 1);
+        CHECK(r.get_properties(0).get_db_type() == db_string);
+        CHECK(r.get<std::string>(0) == "ok");
+
+        // Same for the types retrieved on demand.
+        soci::row r2;
+        sql << "select 'happy'::soci_test_mood as m", into(r2);
+        CHECK(r2.get<std::string>(0) == "happy");
+    }
+    catch (...)
+    {
+        sql << "DROP TYPE soci_test_mood";
+        throw;
+    }
+
+    sql << "DROP TYPE soci_test_mood";
+}
+
 TEST_CASE("test_enum_with_explicit_custom_type_string_into", "[postgresql][bind-variables]")
 {
     TestStringEnum test_value = TestStringEnum::VALUE_STR_2;
@@ -1412,6 +1466,299 @@ TEST_CASE("colon_in_double_quotes_in_single_quotes",
     CHECK(return_value == "hello it is \"10:10\"");
 }
 
+struct array_table_creator : table_creator_base
+{
+    array_table_creator(soci::session & sql)
+        : table_creator_base(sql)
+    {
+        sql << "create table soci_test(id integer, ints integer[], "
+               "strs text[], dbls float8[], flags boolean[])";
+    }
+};
+
+TEST_CASE("PostgreSQL arrays", "[postgresql][array]")
+{
+    soci::session sql(backEnd, connectString);
+
+    array_table_creator tableCreator(sql);
+
+    std::vector<int> ints;
+    ints.push_back(1);
+    ints.push_back(-2);
+    ints.push_back(3);
+
+    std::vector<std::string> strs;
+    strs.push_back("plain");
+    strs.push_back("with \"quotes\" and \\backslash");
+    strs.push_back("with, comma {and braces}");
+    strs.push_back("NULL");
+    strs.push_back("");
+
+    std::vector<double> dbls;
+    dbls.push_back(3.25);
+    dbls.push_back(0.1);
+
+    std::vector<bool> flags;
+    flags.push_back(true);
+    flags.push_back(false);
+
+    sql << "insert into soci_test(id, ints, strs, dbls, flags) "
+           "values(1, :ints, :strs, :dbls, :flags)",
+        use_array(ints), use_array(strs), use_array(dbls), use_array(flags);
+
+    std::vector<int> ints2;
+    std::vector<std::string> strs2;
+    std::vector<double> dbls2;
+    std::vector<bool> flags2;
+    sql << "select ints, strs, dbls, flags from soci_test where id = 1",
+        into_array(ints2), into_array(strs2), into_array(dbls2), into_array(flags2);
+
+    CHECK(ints2 == ints);
+    CHECK(strs2 == strs);
+    CHECK(dbls2 == dbls);
+    CHECK(flags2 == flags);
+
+    // Use an array to look up several values at once.
+    std::vector<int> ids;
+    ids.push_back(1);
+    ids.push_back(2);
+
+    int count = 0;
+    sql << "select count(*) from soci_test where id = ANY(:ids)",
+        use_array(ids), into(count);
+    CHECK(count == 1);
+
+    // Empty and NULL arrays.
+    std::vector<int> empty;
+    sql << "insert into soci_test(id, ints) values(2, :ints)", use_array(empty);
+    sql << "select ints from soci_test where id = 2", into_array(ints2);
+    CHECK(ints2.empty());
+
+    indicator ind = i_ok;
+    sql << "select strs from soci_test where id = 2", into_array(strs2, ind);
+    CHECK(ind == i_null);
+    CHECK(strs2.empty());
+
+    CHECK_THROWS_AS((sql << "select strs from soci_test where id = 2",
+                     into_array(strs2)), soci_error);
+
+    // Non-default lower bounds are handled too.
+    sql << "select '[0:2]={7,8,9}'::integer[]", into_array(ints2);
+    REQUIRE(ints2.size() == 3);
+    CHECK(ints2[0] == 7);
+    CHECK(ints2[2] == 9);
+}
+
+TEST_CASE("PostgreSQL server-side cursors", "[postgresql][cursor]")
+{
+    soci::session sql(backEnd, connectString + " cursors=true");
+
+    soci::transaction tr(sql);
+
+    int const n = 10;
+    std::vector<int> v(4);
+    soci::statement st = (sql.prepare <<
+        "select i from generate_series(1, :n) as i order by i", use(n), into(v));
+    st.execute();
+
+    // Check that the cursor is really used: the query doing it doesn't use a
+    // cursor itself, as it has no vector into elements.
+    int cursors = 0;
+    soci::statement stCursors = (sql.prepare <<
+        "select count(*) from pg_cursors where name like 'st\\_%\\_cursor'",
+        into(cursors));
+    stCursors.execute(true);
+    CHECK(cursors == 1);
+
+    std::vector<int> all;
+    while (st.fetch())
+    {
+        all.insert(all.end(), v.begin(), v.end());
+    }
+
+    // The cursor is closed once all rows have been fetched.
+    stCursors.execute(true);
+    CHECK(cursors == 0);
+
+    REQUIRE(all.size() == 10);
+    for (int i = 0; i != 10; ++i)
+    {
+        CHECK(all[i] == i + 1);
+    }
+
+    // Executing the statement with data exchange must work too.
+    v.resize(3);
+    soci::statement st2 = (sql.prepare <<
+        "select i from generate_series(1, 5) as i order by i", into(v));
+    CHECK(st2.execute(true));
+    REQUIRE(v.size() == 3);
+    CHECK(v[0] == 1);
+    CHECK(v[2] == 3);
+    CHECK(st2.fetch());
+    REQUIRE(v.size() == 2);
+    CHECK(v[1] == 5);
+    CHECK(!st2.fetch());
+
+    // Queries with single into elements don't use cursors by default.
+    int count = 0;
+    soci::statement stCount = (sql.prepare <<
+        "select count(*) from generate_series(1, 3)", into(count));
+    CHECK(stCount.execute(true));
+    CHECK(count == 3);
+    stCursors.execute(true);
+    CHECK(cursors == 0);
+
+    // But they do if it's explicitly requested.
+    soci::statement stRow = (sql.prepare <<
+        "select i from generate_series(1, 3) as i order by i", into(count));
+    static_cast<postgresql_statement_backend*>(stRow.get_backend())
+        ->set_use_cursor(true);
+    CHECK(stRow.execute(true));
+    CHECK(count == 1);
+    stCursors.execute(true);
+    CHECK(cursors == 1);
+    CHECK(stRow.fetch());
+    CHECK(count == 2);
+
+    // But data-modifying WITH queries can't use them and must still work.
+    sql << "create temp table soci_test_cte(i integer)";
+    sql << "with ins as (insert into soci_test_cte values (1), (2) returning i)"
+           " select count(*) from ins", into(count);
+    CHECK(count == 2);
+
+    // While other WITH queries do use cursors.
+    std::vector<int> w(1);
+    soci::statement st3 = (sql.prepare <<
+        "with t as (select i from soci_test_cte) select i from t order by i",
+        into(w));
+    CHECK(st3.execute(true));
+    CHECK(w[0] == 1);
+    stCursors.execute(true);
+    CHECK(cursors == 1);
+    CHECK(st3.fetch());
+    CHECK(w[0] == 2);
+    CHECK(!st3.fetch());
+
+    tr.commit();
+
+    // Queries outside of a transaction don't use cursors, but still work.
+    sql << "select count(*) from generate_series(1, 4)", into(count);
+    CHECK(count == 4);
+
+    sql << "drop table soci_test_cte";
+}
+
+TEST_CASE("PostgreSQL cursors closed behind our back", "[postgresql][cursor]")
+{
+    soci::session sql(backEnd, connectString + " cursors=true");
+
+    soci::transaction tr(sql);
+
+    std::vector<int> v(2);
+
+    // Destroying a partially fetched statement after its cursor had been
+    // closed by rolling back to a savepoint must not break the transaction.
+    sql << "savepoint soci_sp";
+    {
+        soci::statement st = (sql.prepare <<
+            "select i from generate_series(1, 10) as i", into(v));
+        CHECK(st.execute(true));
+        CHECK(v.size() == 2);
+
+        sql << "rollback to savepoint soci_sp";
+    }
+
+    int count = 0;
+    sql << "select count(*) from generate_series(1, 3)", into(count);
+    CHECK(count == 3);
+
+    // The same for the cursor closed by committing the transaction directly.
+    {
+        soci::statement st = (sql.prepare <<
+            "select i from generate_series(1, 10) as i", into(v));
+        CHECK(st.execute(true));
+        CHECK(v.size() == 2);
+
+        sql << "commit";
+        sql << "begin";
+    }
+
+    sql << "select count(*) from generate_series(1, 4)", into(count);
+    CHECK(count == 4);
+
+    tr.commit();
+}
+
+TEST_CASE("PostgreSQL notifications", "[postgresql][notify]")
+{
+    soci::session sql(backEnd, connectString);
+
+    postgresql_session_backend* const sessionBackend =
+        static_cast<postgresql_session_backend*>(sql.get_backend());
+
+    CHECK(sessionBackend->get_socket() >= 0);
+
+    sessionBackend->listen("soci_test_channel");
+
+    postgresql_notification n;
+    CHECK(!sessionBackend->get_notification(n));
+    CHECK(!sessionBackend->wait_for_notification(n, 10));
+
+    sql << "NOTIFY soci_test_channel, 'hello'";
+
+    REQUIRE(sessionBackend->wait_for_notification(n, 5000));
+    CHECK(n.channel == "soci_test_channel");
+    CHECK(n.payload == "hello");
+    CHECK(n.pid != 0);
+
+    CHECK(!sessionBackend->get_notification(n));
+
+    sessionBackend->unlisten("soci_test_channel");
+
+    sql << "NOTIFY soci_test_channel, 'ignored'";
+    CHECK(!sessionBackend->wait_for_notification(n, 10));
+}
+
+TEST_CASE("PostgreSQL single-row mode bulk fetch", "[postgresql][singlerow]")
+{
+    soci::session sql(backEnd, connectString + " singlerow=true");
+
+    std::vector<int> v(4);
+    soci::statement st = (sql.prepare <<
+        "select i from generate_series(1, 10) as i", into(v));
+    st.execute();
+
+    std::vector<int> all;
+    while (st.fetch())
+    {
+        CHECK(v.size() <= 4);
+        all.insert(all.end(), v.begin(), v.end());
+    }
+
+    REQUIRE(all.size() == 10);
+    for (int i = 0; i != 10; ++i)
+    {
+        CHECK(all[i] == i + 1);
+    }
+
+    // The session must be usable for other queries after consuming all rows.
+    int count = 0;
+    sql << "select count(*) from generate_series(1, 3)", into(count);
+    CHECK(count == 3);
+
+    // Single row fetches must still work too.
+    int n = 0;
+    int sum = 0;
+    soci::statement st2 = (sql.prepare <<
+        "select i from generate_series(1, 5) as i", into(n));
+    st2.execute();
+    while (st2.fetch())
+    {
+        sum += n;
+    }
+    CHECK(sum == 15);
+}
+
 //
 // Support for soci Common Tests
 //
@@ -7,10 +7,13 @@
 
 #include <soci/soci.h>
 #include <soci/sqlite3/soci-sqlite3.h>
+#include <soci/sqlite3/wal-pool.h>
 #include "test-context.h"
 
 #include <catch.hpp>
 
+#include <cstdio>
+
 using namespace soci;
 using namespace soci::tests;
 
@@ -765,6 +768,430 @@ TEST_CASE("SQLite vector long long", "[sqlite][vector][longlong]")
     CHECK(v2[4] == 1000000000000LL);
 }
 
+TEST_CASE("SQLite vector strings in several batches", "[sqlite][vector][string]")
+{
+    soci::session sql(backEnd, connectString);
+
+    sql << "create temporary table soci_test(id integer, val text)";
+
+    // Use values of varying lengths, including some bigger than the blocks
+    // used for storing the fetched data internally, to check that the
+    // buffers are correctly reused between batches.
+    std::vector<int> ids;
+    std::vector<std::string> values;
+    for (int i = 0; i < 100; ++i)
+    {
+        ids.push_back(i);
+        values.push_back(std::string(i % 10 == 9 ? 70000 + i : i, 'a' + i % 26));
+    }
+
+    sql << "insert into soci_test(id, val) values(:id, :val)", use(ids), use(values);
+
+    std::vector<int> ids2(7);
+    std::vector<std::string> values2(7);
+    statement st = (sql.prepare <<
+        "select id, val from soci_test order by id", into(ids2), into(values2));
+    st.execute();
+
+    int count = 0;
+    while (st.fetch())
+    {
+        for (std::size_t n = 0; n < ids2.size(); ++n)
+        {
+            CHECK(ids2[n] == count);
+            CHECK(values2[n] == values[count]);
+            ++count;
+        }
+    }
+
+    CHECK(count == 100);
+}
+
+TEST_CASE("SQLite vector binary", "[sqlite][vector][binary]")
+{
+    soci::session sql(backEnd, connectString);
+
+    sql << "create temporary table soci_test(id integer, val blob)";
+
+    // Include the embedded NULs, an empty value and a NULL one.
+    std::vector<int> ids;
+    std::vector<std::vector<uint8_t>> values;
+    std::vector<indicator> inds;
+    for (int i = 0; i < 10; ++i)
+    {
+        std::vector<uint8_t> value;
+        for (int j = 0; j < i*100; ++j)
+            value.push_back(static_cast<uint8_t>(i + j));
+
+        ids.push_back(i);
+        values.push_back(value);
+        inds.push_back(i == 7 ? i_null : i_ok);
+    }
+
+    sql << "insert into soci_test(id, val) values(:id, :val)",
+        use(ids), use(values, inds);
+
+    std::vector<int> ids2(4);
+    std::vector<std::vector<uint8_t>> values2(4);
+    std::vector<indicator> inds2(4);
+    statement st = (sql.prepare << "select id, val from soci_test order by id",
+                    into(ids2), into(values2, inds2));
+    st.execute();
+
+    int count = 0;
+    while (st.fetch())
+    {
+        for (std::size_t n = 0; n < ids2.size(); ++n)
+        {
+            CHECK(ids2[n] == count);
+            if (count == 7)
+            {
+                CHECK(inds2[n] == i_null);
+            }
+            else
+            {
+                CHECK(inds2[n] == i_ok);
+                CHECK(values2[n] == values[count]);
+            }
+            ++count;
+        }
+    }
+
+    CHECK(count == 10);
+}
+
+TEST_CASE("SQLite statement cache", "[sqlite][statement-cache]")
+{
+    soci::session sql(backEnd, "db=:memory: statement_cache=2");
+
+    sqlite3_session_backend* const sessionBackend =
+        static_cast<sqlite3_session_backend*>(sql.get_backend());
+
+    sql << "create table soci_test(id integer, name text)";
+
+    std::string const insertQuery = "insert into soci_test(id, name) values(:id, :name)";
+    sqlite_api::sqlite3_stmt* stmt = NULL;
+    for (int i = 0; i < 3; ++i)
+    {
+        std::string const name = "name" + std::to_string(i);
+        statement st = (sql.prepare << insertQuery, use(i), use(name));
+        st.execute(true);
+
+        // The same statement must be reused every time.
+        sqlite_api::sqlite3_stmt* const
+            stmtCurrent = static_cast<sqlite3_statement_backend*>(st.get_backend())->stmt_;
+        if (stmt)
+            CHECK(stmtCurrent == stmt);
+        stmt = stmtCurrent;
+    }
+
+    int count = 0;
+    sql << "select count(*) from soci_test", into(count);
+    CHECK(count == 3);
+
+    // The values bound during the previous use of the statement must not be
+    // reused.
+    {
+        statement st = (sql.prepare << insertQuery);
+        st.execute(true);
+    }
+
+    indicator ind = i_ok;
+    std::string name;
+    sql << "select name from soci_test where id is null", into(name, ind);
+    CHECK(ind == i_null);
+
+    // The cache size must be limited.
+    sql << "select count(*) from soci_test where id = 1", into(count);
+    sql << "select count(*) from soci_test where id = 2", into(count);
+    CHECK(sessionBackend->statementCache_.size() == 2);
+
+    // Two statements with the same query can be used simultaneously.
+    std::string const selectQuery = "select id from soci_test where id = 1";
+    int id1 = 0, id2 = 0;
+    statement st1 = (sql.prepare << selectQuery, into(id1));
+    statement st2 = (sql.prepare << selectQuery, into(id2));
+    st1.execute(true);
+    st2.execute(true);
+    CHECK(id1 == 1);
+    CHECK(id2 == 1);
+
+    // Changing the schema must not prevent the cached statements from being
+    // used.
+    sql << "alter table soci_test add column extra integer";
+    sql << "select count(*) from soci_test", into(count);
+    CHECK(count == 4);
+}
+
+TEST_CASE("SQLite vector use", "[sqlite][vector][use]")
+{
+    soci::session sql(backEnd, connectString);
+
+    sql << "create temporary table soci_test(id integer, name text, tm datetime)";
+
+    std::vector<int> ids;
+    std::vector<std::string> names;
+    std::vector<indicator> inds;
+    std::vector<std::tm> times;
+    for (int i = 0; i < 10; ++i)
+    {
+        ids.push_back(i);
+        names.push_back(std::string(i, 'x'));
+        inds.push_back(i % 3 ? i_ok : i_null);
+
+        std::tm t = std::tm();
+        t.tm_year = 120;
+        t.tm_mon = 0;
+        t.tm_mday = i + 1;
+        times.push_back(t);
+    }
+
+    SECTION("Inserted values")
+    {
+        sql << "insert into soci_test(id, name, tm) values(:id, :name, :tm)",
+            use(ids), use(names, inds), use(times);
+
+        // A single use element can be combined with the vector ones.
+        int const id = 5;
+        std::vector<std::string> names2(10);
+        std::vector<indicator> inds2(10);
+        std::vector<std::tm> times2(10);
+        sql << "select name, tm from soci_test where id >= :id order by id",
+            use(id), into(names2, inds2), into(times2);
+
+        REQUIRE(names2.size() == 5);
+        for (std::size_t n = 0; n < names2.size(); ++n)
+        {
+            int const i = static_cast<int>(n) + id;
+            CHECK(inds2[n] == inds[i]);
+            if (inds2[n] == i_ok)
+                CHECK(names2[n] == names[i]);
+            CHECK(times2[n].tm_mday == i + 1);
+        }
+    }
+
+    SECTION("Inside a transaction")
+    {
+        // The statement must not commit the changes done by it itself.
+        transaction tr(sql);
+        sql << "insert into soci_test(id) values(:id)", use(ids);
+        tr.rollback();
+
+        int count = -1;
+        sql << "select count(*) from soci_test", into(count);
+        CHECK(count == 0);
+    }
+
+    SECTION("Partial failure")
+    {
+        sql << "create unique index soci_test_id on soci_test(id)";
+
+        ids[5] = 0;
+        statement st = (sql.prepare << "insert into soci_test(id) values(:id)", use(ids));
+        CHECK_THROWS_AS(st.execute(true), sqlite3_soci_error);
+        CHECK(st.get_affected_rows() == 5);
+
+        // The rows inserted before the failure are kept, as they would be
+        // when executing the statement for each of them separately.
+        int count = -1;
+        sql << "select count(*) from soci_test", into(count);
+        CHECK(count == 5);
+    }
+}
+
+TEST_CASE("SQLite journal mode", "[sqlite][connstring][wal]")
+{
+    // WAL can't be used with in-memory databases.
+    CHECK_THROWS_WITH(soci::session(backEnd, "db=:memory: journal_mode=wal"),
+                      Catch::Contains("Cannot use journal mode"));
+
+    CHECK_NOTHROW(soci::session(backEnd, "db=:memory: journal_mode=memory mmap_size=1048576"));
+
+    // Invalid values must be rejected before using them in the pragmas.
+    CHECK_THROWS_WITH(soci::session(backEnd, "db=:memory: journal_mode=wal;drop"),
+                      Catch::Contains("Invalid journal_mode"));
+    CHECK_THROWS_WITH(soci::session(backEnd, "db=:memory: mmap_size=1;drop"),
+                      Catch::Contains("Invalid mmap_size"));
+}
+
+// Removes the database file with the given name and its WAL files.
+struct wal_db_file_remover
+{
+    explicit wal_db_file_remover(std::string const& name) : name_(name) { remove(); }
+    ~wal_db_file_remover() { remove(); }
+
+    void remove()
+    {
+        std::remove(name_.c_str());
+        std::remove((name_ + "-wal").c_str());
+        std::remove((name_ + "-shm").c_str());
+    }
+
+    std::string const name_;
+};
+
+TEST_CASE("SQLite WAL pool", "[sqlite][pool][wal]")
+{
+    wal_db_file_remover remover("soci_wal_pool_test.db");
+
+    CHECK_THROWS_WITH(sqlite3_wal_pool("db=" + remover.name_ + " readonly=1", 2),
+                      Catch::Contains("must not contain readonly"));
+
+    sqlite3_wal_pool pool("db=" + remover.name_ + " timeout=5 mmap_size=1048576", 2);
+    CHECK(pool.readers_count() == 2);
+
+    {
+        soci::session sql(pool.writer());
+        sql << "create table soci_test(id integer)";
+        sql << "insert into soci_test(id) values(1)";
+
+        std::string mode;
+        sql << "pragma journal_mode", into(mode);
+        CHECK(mode == "wal");
+    }
+
+    soci::session reader(pool.readers());
+
+    int count = 0;
+    reader << "select count(*) from soci_test", into(count);
+    CHECK(count == 1);
+
+    // The readers can't modify the database.
+    CHECK_THROWS_AS(reader << "insert into soci_test(id) values(2)", soci_error);
+
+    // And a reader in the middle of a transaction doesn't prevent the writer
+    // from committing, while still seeing the old data itself.
+    transaction tr(reader);
+    reader << "select count(*) from soci_test", into(count);
+
+    {
+        soci::session sql(pool.writer());
+        sql << "insert into soci_test(id) values(3)";
+    }
+
+    reader << "select count(*) from soci_test", into(count);
+    CHECK(count == 1);
+
+    tr.commit();
+
+    reader << "select count(*) from soci_test", into(count);
+    CHECK(count == 2);
+}
+
+struct blob_table_creator : table_creator_base
+{
+    blob_table_creator(soci::session & sql)
+        : table_creator_base(sql)
+    {
+        sql << "create table soci_test(id integer primary key, b blob)";
+    }
+};
+
+TEST_CASE("SQLite incremental BLOB I/O", "[sqlite][blob]")
+{
+    soci::session sql(backEnd, connectString);
+
+    blob_table_creator tableCreator(sql);
+
+    // Reserve the space for the BLOB when inserting, as its size can't be
+    // changed when it is opened for incremental I/O.
+    std::size_t const size = 100000;
+    int const sizeInt = static_cast<int>(size);
+    sql << "insert into soci_test(id, b) values(1, zeroblob(:n))", use(sizeInt);
+    sql << "insert into soci_test(id, b) values(2, x'0102')";
+
+    blob b(sql);
+    sqlite3_blob_backend* const bbe = static_cast<sqlite3_blob_backend*>(b.get_backend());
+
+    CHECK_THROWS_AS(bbe->open("soci_test", "b", 3), sqlite3_soci_error);
+    CHECK(!bbe->is_open());
+
+    bbe->open("soci_test", "b", 1, true);
+    REQUIRE(bbe->is_open());
+    CHECK(b.get_len() == size);
+
+    // Write the data in chunks.
+    std::vector<char> chunk(4096);
+    for (std::size_t offset = 0; offset < size; offset += chunk.size())
+    {
+        std::fill(chunk.begin(), chunk.end(), static_cast<char>(offset / chunk.size()));
+        std::size_t const n = std::min(chunk.size(), size - offset);
+        CHECK(b.write_from_start(&chunk[0], n, offset) == n);
+    }
+
+    CHECK_THROWS_AS(b.append("x", 1), soci_error);
+    CHECK_THROWS_AS(b.trim(10), soci_error);
+    CHECK_THROWS_AS((sql << "insert into soci_test(b) values(:b)", use(b)), soci_error);
+
+    // Read it back in chunks too.
+    bbe->open("soci_test", "b", 1);
+    char buf[1000];
+    CHECK(b.read_from_start(buf, sizeof(buf), 5000) == sizeof(buf));
+    CHECK(buf[0] == 1);
+    CHECK(buf[sizeof(buf) - 1] == 1);
+    CHECK(b.read_from_start(buf, sizeof(buf), size - 10) == 10);
+    CHECK(buf[9] == static_cast<char>((size - 1) / chunk.size()));
+
+    // Read-only BLOB can't be written to.
+    CHECK_THROWS_AS(b.write_from_start("x", 1, 0), sqlite3_soci_error);
+
+    // Switch to another row.
+    bbe->reopen(2);
+    CHECK(b.get_len() == 2);
+    CHECK(b.read_from_start(buf, sizeof(buf)) == 2);
+    CHECK(buf[1] == 2);
+
+    // Selecting into the BLOB closes it.
+    sql << "select b from soci_test where id = 1", into(b);
+    CHECK(!bbe->is_open());
+    REQUIRE(b.get_len() == size);
+    CHECK(b.read_from_start(buf, 1, 4096) == 1);
+    CHECK(buf[0] == 1);
+}
+
+namespace
+{
+
+// SQL function counting the number of times it is called.
+void count_calls(sqlite_api::sqlite3_context* ctx, int, sqlite_api::sqlite3_value**)
+{
+    int* const counter = static_cast<int*>(sqlite_api::sqlite3_user_data(ctx));
+    sqlite_api::sqlite3_result_int(ctx, ++*counter);
+}
+
+} // anonymous namespace
+
+TEST_CASE("SQLite describe doesn't execute the query twice", "[sqlite][describe]")
+{
+    soci::session sql(backEnd, connectString);
+
+    int counter = 0;
+    sqlite_api::sqlite3* const conn =
+        static_cast<sqlite3_session_backend*>(sql.get_backend())->conn_;
+    REQUIRE(sqlite_api::sqlite3_create_function(conn, "soci_count_calls", 0,
+                SQLITE_UTF8, &counter, &count_calls, NULL, NULL)
+            == SQLITE_OK);
+
+    // The type of a column with an unknown declared type is only known after
+    // executing the query, but its first row must be reused instead of
+    // executing it again.
+    sql << "create temporary table soci_test(val json)";
+    sql << "insert into soci_test(val) values(17)";
+    sql << "insert into soci_test(val) values(42)";
+
+    rowset<row> rs = (sql.prepare <<
+        "select val from soci_test where soci_count_calls() > 0 order by val");
+    rowset<row>::const_iterator it = rs.begin();
+    REQUIRE(it != rs.end());
+    CHECK(it->get_properties(0).get_db_type() == db_int32);
+    CHECK(it->get<int>(0) == 17);
+    REQUIRE(++it != rs.end());
+    CHECK(it->get<int>(0) == 42);
+    CHECK(++it == rs.end());
+
+    CHECK(counter == 2);
+}
+
 struct type_inference_table_creator : table_creator_base
 {
     type_inference_table_creator(soci::session & sql)